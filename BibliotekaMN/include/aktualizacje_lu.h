@@ -0,0 +1,146 @@
+//
+// Created by Szymon Ros on 17/10/2026.
+//
+
+#ifndef AKTUALIZACJE_LU_H
+#define AKTUALIZACJE_LU_H
+
+#include <memory>
+#include <vector>
+#include "macierz.h"
+#include "uklady_liniowe.h"
+using namespace std;
+
+namespace biblioteka_numeryczna {
+    /**
+     * @brief Rozwiązywanie układów z macierzą A + U V^T na podstawie gotowego rozkładu A (wzór Shermana-Morrisona-Woodbury'ego)
+     *
+     * (A + U V^T)^{-1} b = y - Z (I + V^T Z)^{-1} V^T y, gdzie y = A^{-1} b, Z = A^{-1} U.
+     * Konstruktor wykonuje k rozwiązań z rozkładem A (O(k n^2)) i rozkład macierzy k x k,
+     * każde solve to jedno rozwiązanie z A i O(k n) - zamiast nowego rozkładu O(n^3).
+     * Rozkład A jest współdzielony, więc działa też z rozkładami z PamiecRozkladow.
+     * Dla macierzy I + V^T Z osobliwej (A + U V^T osobliwa) konstruktor rzuca runtime_error.
+     * Dla poprawek o dużej normie wynik może tracić dokładność - wtedy lepiej wykonać nowy rozkład.
+     *
+     * Przykład użycia (zmiana wiersza 2 macierzy A):
+     * auto lu = make_shared<const RozkladLU>(A);
+     * vector<double> roznica(n);
+     * for (int j = 0; j < n; j++) roznica[j] = nowyWiersz[j] - A(2, j);
+     * RozkladLUZPoprawka poprawiony = RozkladLUZPoprawka::zmianaWiersza(lu, 2, roznica);
+     * vector<double> x = poprawiony.solve(b);
+     */
+    class RozkladLUZPoprawka {
+    public:
+        /**
+         * @param baza Rozkład macierzy A (n x n)
+         * @param U Macierz n x k
+         * @param V Macierz n x k
+         */
+        RozkladLUZPoprawka(shared_ptr<const RozkladLU> baza, const Macierz& U, const Macierz& V);
+
+        /**
+         * @brief Poprawka rzędu 1: wiersz i macierzy A zwiększony o roznica (U = e_i, V = roznica)
+         */
+        static RozkladLUZPoprawka zmianaWiersza(shared_ptr<const RozkladLU> baza, int i, const vector<double>& roznica);
+
+        /**
+         * @brief Poprawka rzędu 1: kolumna j macierzy A zwiększona o roznica (U = roznica, V = e_j)
+         */
+        static RozkladLUZPoprawka zmianaKolumny(shared_ptr<const RozkladLU> baza, int j, const vector<double>& roznica);
+
+        /**
+         * @brief Rozwiązuje (A + U V^T) x = b
+         */
+        vector<double> solve(const vector<double>& b) const;
+
+        int rozmiar() const { return baza_->rozmiar(); }
+        int rzadPoprawki() const { return Z_.kolumny(); }
+
+    private:
+        shared_ptr<const RozkladLU> baza_;
+        Macierz Z_;                 // A^{-1} U, n x k
+        Macierz VT_;                // V^T, k x n
+        RozkladLU pojemnosc_;       // rozkład I + V^T Z
+    };
+
+    /**
+     * @brief Rozkład LU aktualizowany przy zamianie kolumn macierzy (metoda Forresta-Tomlina)
+     *
+     * Przechowuje A = P^T L E^{-1} U, gdzie E to iloczyn elementarnych przekształceń wierszy
+     * (po jednym na aktualizację), a U jest trójkątna górna po symetrycznej permutacji
+     * kolejności elementów głównych. Zamiana kolumny j: nowa kolumna po przekształceniu
+     * L^{-1} i E trafia do U jako "kolec", j przechodzi na koniec kolejności, a wiersz j jest
+     * zerowany pozostałymi wierszami U - koszt O(n^2) zamiast O(n^3) nowego rozkładu.
+     *
+     * Metoda Forresta-Tomlina nie wybiera elementu głównego, więc gdy nowy element przekątnej
+     * jest mały względem kolumny (|u_jj| < progStabilnosci * max|kolec|), albo po
+     * maksymalnaLiczbaAktualizacji zamianach (przekształcenia E wydłużają solve), wykonywany
+     * jest nowy rozkład z pivotingiem z przechowywanej kopii A. Gdy nowa macierz jest osobliwa,
+     * zamienKolumne rzuca runtime_error i rozkład pozostaje bez zmian.
+     *
+     * Przykład użycia (metoda sympleks, zamiana kolumny bazy):
+     * RozkladLUAktualizowany baza(B);
+     * while (...) {
+     *     vector<double> x = baza.solve(b);
+     *     ...
+     *     baza.zamienKolumne(wychodzaca, kolumnaWchodzaca);
+     * }
+     */
+    class RozkladLUAktualizowany {
+    public:
+        /**
+         * @param A Macierz n x n
+         * @param maksymalnaLiczbaAktualizacji Liczba zamian kolumn, po której rozkład jest liczony od nowa
+         * @param progStabilnosci Względny próg elementu przekątnej, poniżej którego rozkład jest liczony od nowa
+         */
+        explicit RozkladLUAktualizowany(const Macierz& A, int maksymalnaLiczbaAktualizacji = 64,
+                                        double progStabilnosci = 1e-8);
+
+        /**
+         * @brief Zamienia kolumnę j macierzy na kolumna i aktualizuje rozkład
+         */
+        void zamienKolumne(int j, const vector<double>& kolumna);
+
+        /**
+         * @brief Rozwiązuje Ax = b dla bieżącej macierzy A
+         */
+        vector<double> solve(const vector<double>& b) const;
+
+        int rozmiar() const { return A_.wiersze(); }
+        const Macierz& macierz() const { return A_; }
+
+        /**
+         * @brief Liczba zamian kolumn wykonanych od ostatniego pełnego rozkładu
+         */
+        int liczbaAktualizacji() const { return static_cast<int>(przeksztalcenia_.size()); }
+
+        /**
+         * @brief Liczba pełnych rozkładów wykonanych od utworzenia (łącznie z pierwszym)
+         */
+        int liczbaRozkladow() const { return liczbaRozkladow_; }
+
+    private:
+        // wiersz -= sum mnozniki[t] * wiersz kolumny[t]
+        struct Przeksztalcenie {
+            int wiersz;
+            vector<int> kolumny;
+            vector<double> mnozniki;
+        };
+
+        void rozloz();
+        void przeksztalc(vector<double>& b) const;      // b := E L^{-1} P b
+
+        Macierz A_;
+        Macierz LU_;                // rozkład z ostatniego pełnego rozkładu (używane L)
+        vector<int> zamiany_;
+        Macierz U_;                 // bieżąca U, indeksy wierszy i kolumn jak w A
+        vector<int> kolejnosc_;     // kolejność elementów głównych
+        vector<int> pozycja_;       // odwrotność kolejnosc_
+        vector<Przeksztalcenie> przeksztalcenia_;
+        int maksymalnaLiczbaAktualizacji_;
+        double progStabilnosci_;
+        int liczbaRozkladow_ = 0;
+    };
+}
+
+#endif // AKTUALIZACJE_LU_H
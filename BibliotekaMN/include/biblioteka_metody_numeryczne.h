@@ -9,6 +9,20 @@
 //
 // Dostępne moduły:
 // - uklady_liniowe.h: Rozwiązywanie układów równań liniowych
+// - uklady_male.h: Małe układy o rozmiarze znanym w czasie kompilacji, także wsadowo (SIMD)
+// - pamiec_rozkladow.h: Pamięć podręczna rozkładów LU (LRU) dla powtarzających się macierzy
+// - aktualizacje_lu.h: Aktualizacje rozkładu LU (Sherman-Morrison-Woodbury, Forrest-Tomlin)
+// - rozklady_rzadkie.h: Rzadkie rozkłady LU i Cholesky'ego z uporządkowaniem i analizą symboliczną
+// - macierz.h: Gęsta macierz w ciągłym, wyrównanym buforze (Macierz)
+// - macierz_rzadka.h: Macierz rzadka w formacie CSR (MacierzRzadkaCSR), kolorowanie i uporządkowania grafu
+// - macierz_pasmowa.h: Macierz pasmowa z miejscem na wypełnienie rozkładu LU (MacierzPasmowa)
+// - plik_mapowany.h: Plik zmapowany do pamięci (szybkie wczytywanie danych)
+// - format_binarny.h: Binarny format macierzy i wektorów używany bez kopiowania po zmapowaniu
+// - format_mtx.h: Wczytywanie i zapis macierzy rzadkich w formacie Matrix Market (.mtx)
+// - lu_poza_pamiecia.h: Rozkład LU macierzy większych niż pamięć operacyjna (plik roboczy, panele)
+// - sledzenie.h: Opcjonalne śledzenie przebiegu obliczeń (domyślnie wyłączone)
+// - pula_watkow.h: Pula wątków z kradzieżą zadań i graf zależności zadań
+// - jadra_simd.h: Jądra axpy / iloczyn skalarny / podstawianie (AVX2, AVX-512, skalarne)
 // - interpolacja.h: Interpolacja wielomianowa (Lagrange, Newton)
 // - aproksymacja.h: Aproksymacja funkcji metodą najmniejszych kwadratów
 // - calkowanie_numeryczne.h: Całkowanie numeryczne (prostokąty, trapezy, Simpson, Gauss)
@@ -36,7 +50,21 @@
 #ifndef BIBLIOTEKA_NUMERYCZNA_H
 #define BIBLIOTEKA_NUMERYCZNA_H
 
+#include "macierz.h"
+#include "macierz_rzadka.h"
+#include "macierz_pasmowa.h"
+#include "plik_mapowany.h"
+#include "format_binarny.h"
+#include "format_mtx.h"
+#include "lu_poza_pamiecia.h"
+#include "sledzenie.h"
+#include "pula_watkow.h"
+#include "jadra_simd.h"
 #include "uklady_liniowe.h"
+#include "uklady_male.h"
+#include "pamiec_rozkladow.h"
+#include "aktualizacje_lu.h"
+#include "rozklady_rzadkie.h"
 #include "interpolacja.h"
 #include "aproksymacja.h"
 #include "calkowanie_numeryczne.h"
@@ -0,0 +1,225 @@
+//
+// Created by Szymon Ros on 17/10/2026.
+//
+
+#ifndef FORMAT_BINARNY_H
+#define FORMAT_BINARNY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "macierz.h"
+#include "macierz_rzadka.h"
+#include "macierz_pasmowa.h"
+#include "plik_mapowany.h"
+using namespace std;
+
+namespace biblioteka_numeryczna {
+    /**
+     * @brief Sposób zapisu macierzy w pliku binarnym
+     */
+    enum class RodzajMacierzy : uint32_t {
+        Gesta = 1,
+        CSR = 2,
+        Pasmowa = 3
+    };
+
+    /**
+     * @brief Nagłówek pliku binarnego (128 B, kolejność bajtów maszyny, która zapisała plik)
+     *
+     * Po nagłówku leżą sekcje danych, każda zaczyna się od przesunięcia będącego
+     * wielokrotnością `wyrownanie` (64 B), więc po zmapowaniu pliku wiersze macierzy
+     * gęstej są wyrównane tak samo jak w klasie Macierz.
+     * - Gesta: wiersze * krok liczb double (wiersz i od elementu i * krok)
+     * - CSR: wartości (double), indeksy kolumn (int32), początki wierszy (int32, wiersze + 1)
+     * - Pasmowa: wiersze * krok liczb double w układzie MacierzPasmowa (krok = 2 * dolna + gorna + 1)
+     * Opcjonalny wektor wyrazów wolnych (double) ma długość dlugoscWektora (0 - brak wektora).
+     */
+    struct NaglowekBinarny {
+        char magia[8];                      // "BMNBIN\0\0"
+        uint32_t wersja;
+        uint32_t znacznikKolejnosci;        // 0x01020304 zapisane w kolejności bajtów maszyny
+        uint32_t rodzaj;                    // RodzajMacierzy
+        uint32_t typDanych;                 // 1 = double (IEEE 754, 64 bity)
+        uint32_t typIndeksow;               // 1 = int32
+        uint32_t wyrownanie;
+        int64_t wiersze;
+        int64_t kolumny;
+        int64_t krok;
+        int64_t liczbaNiezerowych;
+        int64_t dolna;
+        int64_t gorna;
+        int64_t dlugoscWektora;
+        uint64_t przesuniecieDanych;
+        uint64_t przesuniecieIndeksow;
+        uint64_t przesunieciePoczatkow;
+        uint64_t przesuniecieWektora;
+        uint64_t zarezerwowane;
+    };
+
+    static_assert(sizeof(NaglowekBinarny) == 128, "Nagłówek pliku binarnego musi mieć 128 B");
+
+    /**
+     * @brief Widok (bez kopiowania) na gęstą macierz zapisaną wierszami z krokiem `krok`
+     */
+    class WidokMacierzy {
+    public:
+        WidokMacierzy(const double* dane, int wiersze, int kolumny, int krok)
+            : dane_(dane), wiersze_(wiersze), kolumny_(kolumny), krok_(krok) {}
+
+        int wiersze() const { return wiersze_; }
+        int kolumny() const { return kolumny_; }
+        int krok() const { return krok_; }
+        const double* dane() const { return dane_; }
+        const double* wiersz(int i) const { return dane_ + static_cast<size_t>(i) * krok_; }
+        const double& operator()(int i, int j) const { return dane_[static_cast<size_t>(i) * krok_ + j]; }
+
+        /**
+         * @brief Kopia do macierzy (np. do rozkładu LU, który nadpisuje dane)
+         */
+        Macierz doMacierzy() const;
+
+    private:
+        const double* dane_;
+        int wiersze_;
+        int kolumny_;
+        int krok_;
+    };
+
+    /**
+     * @brief Widok (bez kopiowania) na tablice macierzy CSR
+     */
+    class WidokCSR {
+    public:
+        WidokCSR(int wiersze, int kolumny, const int* poczatkiWierszy,
+                 const int* indeksyKolumn, const double* wartosci)
+            : wiersze_(wiersze), kolumny_(kolumny), poczatkiWierszy_(poczatkiWierszy),
+              indeksyKolumn_(indeksyKolumn), wartosci_(wartosci) {}
+
+        int wiersze() const { return wiersze_; }
+        int kolumny() const { return kolumny_; }
+        int liczbaNiezerowych() const { return poczatkiWierszy_[wiersze_]; }
+        const int* poczatkiWierszy() const { return poczatkiWierszy_; }
+        const int* indeksyKolumn() const { return indeksyKolumn_; }
+        const double* wartosci() const { return wartosci_; }
+
+        MacierzRzadkaCSR doMacierzyCSR() const;
+
+    private:
+        int wiersze_;
+        int kolumny_;
+        const int* poczatkiWierszy_;
+        const int* indeksyKolumn_;
+        const double* wartosci_;
+    };
+
+    /**
+     * @brief Widok (bez kopiowania) na bufor macierzy pasmowej w układzie MacierzPasmowa
+     */
+    class WidokPasmowy {
+    public:
+        WidokPasmowy(const double* dane, int rozmiar, int dolna, int gorna)
+            : dane_(dane), rozmiar_(rozmiar), dolna_(dolna), gorna_(gorna),
+              szerokosc_(2 * dolna + gorna + 1) {}
+
+        int rozmiar() const { return rozmiar_; }
+        int dolna() const { return dolna_; }
+        int gorna() const { return gorna_; }
+        int szerokosc() const { return szerokosc_; }
+        const double* dane() const { return dane_; }
+
+        /**
+         * @brief Element (i, j); dostęp bez sprawdzania, dozwolony dla -dolna <= j - i <= gorna
+         */
+        const double& operator()(int i, int j) const { return dane_[static_cast<size_t>(i) * szerokosc_ + (j - i + dolna_)]; }
+
+        /**
+         * @brief Kopia do macierzy pasmowej (rozkład LU pasmowy odbywa się w miejscu)
+         */
+        MacierzPasmowa doMacierzyPasmowej() const;
+
+    private:
+        const double* dane_;
+        int rozmiar_;
+        int dolna_;
+        int gorna_;
+        int szerokosc_;
+    };
+
+    /**
+     * @brief Plik binarny z macierzą (i opcjonalnie wektorem b) zmapowany do pamięci
+     *
+     * Konstruktor sprawdza nagłówek (sygnaturę, wersję, kolejność bajtów, typ danych,
+     * położenie sekcji względem rozmiaru pliku, a dla CSR także spójność indeksów)
+     * i rzuca runtime_error, gdy plik jest uszkodzony lub w nieobsługiwanej wersji.
+     * Widoki wskazują bezpośrednio na zmapowane strony, więc są ważne tak długo,
+     * jak długo żyje obiekt PlikBinarny.
+     *
+     * Przykład użycia:
+     * konwertujNaBinarny("plikA.txt", "plikA.bmn");
+     * PlikBinarny plik("plikA.bmn");
+     * vector<double> b = plik.wektor();
+     * RaportZbieznosci wynik = metodaGMRES(operatorMacierzy(plik.macierzGesta()), b, vector<double>(b.size(), 0.0));
+     */
+    class PlikBinarny {
+    public:
+        static constexpr uint32_t WERSJA = 1;
+
+        explicit PlikBinarny(const string& sciezka);
+
+        const NaglowekBinarny& naglowek() const { return naglowek_; }
+        RodzajMacierzy rodzaj() const { return static_cast<RodzajMacierzy>(naglowek_.rodzaj); }
+        int wiersze() const { return static_cast<int>(naglowek_.wiersze); }
+        int kolumny() const { return static_cast<int>(naglowek_.kolumny); }
+
+        /**
+         * @brief Widoki na macierz; rzucają runtime_error, gdy plik zawiera inny rodzaj macierzy
+         */
+        WidokMacierzy macierzGesta() const;
+        WidokCSR macierzCSR() const;
+        WidokPasmowy macierzPasmowa() const;
+
+        bool maWektor() const { return naglowek_.dlugoscWektora > 0; }
+        StalyWidokWektora widokWektora() const;
+
+        /**
+         * @brief Kopia wektora b (solvery przyjmują vector<double>); pusty, gdy plik go nie zawiera
+         */
+        vector<double> wektor() const;
+
+    private:
+        const char* sekcja(uint64_t przesuniecie) const { return plik_.dane() + przesuniecie; }
+
+        PlikMapowany plik_;
+        NaglowekBinarny naglowek_;
+    };
+
+    /**
+     * @brief Zapisuje macierz (i opcjonalnie wektor b) w formacie binarnym
+     * @param sciezka Plik docelowy (nadpisywany)
+     * @param A Macierz w jednym z obsługiwanych formatów
+     * @param b Wektor wyrazów wolnych; pusty - bez wektora
+     *
+     * Przykład użycia:
+     * Macierz A = {{4, 1}, {1, 3}};
+     * zapiszBinarnie("uklad.bmn", A, {1, 2});
+     */
+    void zapiszBinarnie(const string& sciezka, const Macierz& A, const vector<double>& b = {});
+    void zapiszBinarnie(const string& sciezka, const MacierzRzadkaCSR& A, const vector<double>& b = {});
+    void zapiszBinarnie(const string& sciezka, const MacierzPasmowa& A, const vector<double>& b = {});
+
+    /**
+     * @brief Konwertuje plik tekstowy czytany przez wczytajDane na plik binarny
+     * @param plikTekstowy Plik w formacie tekstowym (N:, b:, A:)
+     * @param plikBinarny Plik docelowy
+     * @param rodzaj Sposób zapisu macierzy (CSR i Pasmowa pomijają zera)
+     *
+     * Przykład użycia:
+     * konwertujNaBinarny("plikA.txt", "plikA.bmn", RodzajMacierzy::CSR);
+     */
+    void konwertujNaBinarny(const string& plikTekstowy, const string& plikBinarny,
+                            RodzajMacierzy rodzaj = RodzajMacierzy::Gesta);
+}
+
+#endif // FORMAT_BINARNY_H
@@ -0,0 +1,55 @@
+//
+// Created by Szymon Ros on 17/10/2026.
+//
+
+#ifndef FORMAT_MTX_H
+#define FORMAT_MTX_H
+
+#include <string>
+#include <vector>
+#include "macierz_rzadka.h"
+using namespace std;
+
+namespace biblioteka_numeryczna {
+    /**
+     * @brief Wczytuje macierz rzadką z pliku Matrix Market (.mtx) od razu do formatu CSR
+     * @param sciezka Plik w formacie "%%MatrixMarket matrix coordinate ..."
+     * @return Macierz CSR; powtórzone pozycje są sumowane, kolumny w wierszach posortowane
+     *
+     * Obsługiwane pola: real, integer, pattern (wartości 1); symetrie: general, symmetric,
+     * skew-symmetric (brakujący trójkąt jest odtwarzany). Plik jest mapowany do pamięci
+     * i czytany dwukrotnie: pierwszy przebieg liczy elementy w wierszach, drugi wpisuje je
+     * na miejsce w tablicach CSR, więc poza samą macierzą potrzeba tylko O(wiersze) pamięci
+     * (nigdy nie powstaje macierz gęsta ani lista trójek).
+     * Przy błędnych danych rzuca runtime_error z nazwą pliku i numerem linii.
+     *
+     * Przykład użycia:
+     * MacierzRzadkaCSR A = wczytajMatrixMarket("bcsstk14.mtx");
+     * RaportZbieznosci wynik = metodaGradientowSprzezonych(A, b, x0);
+     */
+    MacierzRzadkaCSR wczytajMatrixMarket(const string& sciezka);
+
+    /**
+     * @brief Zapisuje macierz CSR w formacie Matrix Market (coordinate real)
+     * @param sciezka Plik docelowy (nadpisywany)
+     * @param A Macierz
+     * @param symetryczna Gdy true, zapisywany jest tylko dolny trójkąt z nagłówkiem "symmetric"
+     *                    (macierz musi być symetryczna - nie jest to sprawdzane)
+     *
+     * Liczby są zapisywane w najkrótszej postaci odtwarzającej dokładnie tę samą wartość double.
+     *
+     * Przykład użycia:
+     * zapiszMatrixMarket("wynik.mtx", A);
+     */
+    void zapiszMatrixMarket(const string& sciezka, const MacierzRzadkaCSR& A, bool symetryczna = false);
+
+    /**
+     * @brief Zapisuje wektor (np. rozwiązanie układu) w formacie Matrix Market "array real general"
+     *
+     * Przykład użycia:
+     * zapiszMatrixMarket("x.mtx", wynik.x);
+     */
+    void zapiszMatrixMarket(const string& sciezka, const vector<double>& x);
+}
+
+#endif // FORMAT_MTX_H
@@ -0,0 +1,70 @@
+//
+// Created by Szymon Ros on 17/10/2026.
+//
+
+#ifndef JADRA_SIMD_H
+#define JADRA_SIMD_H
+
+#include <string>
+#include "macierz.h"
+using namespace std;
+
+namespace biblioteka_numeryczna {
+    /**
+     * @brief Wariant jąder wektorowych wybrany dla bieżącego procesora
+     */
+    enum class SciezkaSimd {
+        Skalarna,
+        AVX2,
+        AVX512
+    };
+
+    /**
+     * @brief Zwraca ścieżkę, którą wykonują jądra (wybraną przy pierwszym użyciu na podstawie CPUID)
+     *
+     * Przykład użycia:
+     * cout << "Jądra: " << nazwaSciezkiSimd(aktywnaSciezkaSimd()) << endl;
+     */
+    SciezkaSimd aktywnaSciezkaSimd();
+
+    /**
+     * @brief Nazwa ścieżki do wypisania ("skalarna", "AVX2", "AVX-512")
+     */
+    string nazwaSciezkiSimd(SciezkaSimd sciezka);
+
+    /**
+     * @brief Wymusza ścieżkę jąder (np. do porównań); ścieżka nieobsługiwana przez procesor jest obniżana
+     * @return Ścieżka faktycznie ustawiona
+     */
+    SciezkaSimd wymusSciezkeSimd(SciezkaSimd sciezka);
+
+    /**
+     * @brief y += alfa * x dla n elementów
+     *
+     * Przykład użycia:
+     * axpy(n - i, -wspolczynnik, A.wiersz(i) + i, A.wiersz(k) + i);   // wiersz_k -= w * wiersz_i
+     */
+    void axpy(int n, double alfa, const double* x, double* y);
+
+    /**
+     * @brief Iloczyn skalarny n elementów x i y
+     */
+    double iloczynSkalarny(int n, const double* x, const double* y);
+
+    /**
+     * @brief Podstawianie w przód Lx = b w miejscu (b nadpisywane rozwiązaniem)
+     * @param L Macierz, z której brana jest część dolna trójkątna
+     * @param b Wektor wyrazów wolnych o długości L.wiersze()
+     * @param jedynkiNaPrzekatnej Czy przyjąć jedynki na przekątnej (L spakowane razem z U)
+     */
+    void podstawianieWPrzod(const Macierz& L, double* b, bool jedynkiNaPrzekatnej);
+
+    /**
+     * @brief Podstawianie wsteczne Ux = b w miejscu (b nadpisywane rozwiązaniem)
+     * @param U Macierz, z której brana jest część górna trójkątna z przekątną
+     * @param b Wektor wyrazów wolnych o długości U.wiersze()
+     */
+    void podstawianieWstecz(const Macierz& U, double* b);
+}
+
+#endif // JADRA_SIMD_H
@@ -0,0 +1,95 @@
+//
+// Created by Szymon Ros on 17/10/2026.
+//
+
+#ifndef LU_POZA_PAMIECIA_H
+#define LU_POZA_PAMIECIA_H
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+#include "macierz.h"
+#include "format_binarny.h"
+using namespace std;
+
+namespace biblioteka_numeryczna {
+    /**
+     * @brief Ustawienia rozkładu LU poza pamięcią operacyjną
+     */
+    struct UstawieniaPozaPamiecia {
+        size_t budzetPamieci = size_t(256) << 20;   // bajty na bufory paneli (trzy panele n x szerokość)
+        string plikRoboczy;                         // pusty - plik tymczasowy w katalogu tymczasowym
+        bool wczytywanieWyprzedzajace = true;       // wczytywanie kolejnego panelu w osobnym wątku
+    };
+
+    /**
+     * @brief Rozkład LU z pivotingiem dla macierzy większych niż pamięć operacyjna
+     *
+     * Macierz jest przepisywana do pliku roboczego zmapowanego do pamięci, ułożonego panelami
+     * kolumn (panel to n wierszy x szerokoscPanelu() kolumn w ciągłym obszarze pliku).
+     * Rozkład jest lewostronny (left-looking): dla każdego panelu wczytywane są kolejno
+     * wcześniejsze panele L i odejmowany jest ich wkład, po czym panel jest rozkładany
+     * z częściowym wyborem elementu głównego i zapisywany z powrotem. W pamięci są naraz
+     * tylko trzy panele: bieżący, przetwarzany panel L i panel wczytywany w tle przez drugi
+     * wątek, więc szerokość panelu wynika z budżetu pamięci: budzet / (3 * 8 * n).
+     * Ruch danych to O(n^3 / szerokość) liczb, dlatego większy budżet oznacza mniej odczytów.
+     *
+     * Rozwiązanie układu czyta każdy panel dwa razy (podstawianie w przód i wstecz).
+     * Przy elemencie głównym o module mniejszym niż 1e-10 konstruktor rzuca runtime_error
+     * ("Macierz jest osobliwa"), tak jak RozkladLU. Plik roboczy jest usuwany w destruktorze.
+     *
+     * Przykład użycia:
+     * PlikBinarny plik("duza_macierz.bmn");              // np. 40000 x 40000, 12.8 GB
+     * UstawieniaPozaPamiecia ustawienia;
+     * ustawienia.budzetPamieci = size_t(2) << 30;        // 2 GB na panele
+     * RozkladLUPozaPamiecia lu(plik.macierzGesta(), ustawienia);
+     * vector<double> x = lu.solve(plik.wektor());
+     */
+    class RozkladLUPozaPamiecia {
+    public:
+        explicit RozkladLUPozaPamiecia(const WidokMacierzy& A, const UstawieniaPozaPamiecia& ustawienia = {});
+        explicit RozkladLUPozaPamiecia(const Macierz& A, const UstawieniaPozaPamiecia& ustawienia = {});
+        ~RozkladLUPozaPamiecia();
+
+        RozkladLUPozaPamiecia(const RozkladLUPozaPamiecia&) = delete;
+        RozkladLUPozaPamiecia& operator=(const RozkladLUPozaPamiecia&) = delete;
+
+        /**
+         * @brief Rozwiązuje Ax = b
+         */
+        vector<double> solve(const vector<double>& b) const;
+
+        /**
+         * @brief Rozwiązuje Ax = b nadpisując b rozwiązaniem
+         */
+        void solve_in_place(vector<double>& b) const;
+
+        int rozmiar() const { return n_; }
+        int szerokoscPanelu() const { return szerokosc_; }
+        int liczbaPaneli() const { return (n_ + szerokosc_ - 1) / szerokosc_; }
+
+        /**
+         * @brief Zamiany wierszy: w kroku k zamieniany był wiersz k z wierszem zamiany()[k]
+         */
+        const vector<int>& zamiany() const { return zamiany_; }
+
+    private:
+        class PlikRoboczy;
+
+        void rozloz(const WidokMacierzy& A);
+        void wczytajPanel(int p, double* bufor) const;
+        void zapiszPanel(int p, const double* bufor);
+        int poczatekPanelu(int p) const { return p * szerokosc_; }
+        int szerokoscPanelu(int p) const { return min(szerokosc_, n_ - p * szerokosc_); }
+
+        int n_;
+        int szerokosc_;
+        bool wyprzedzajace_;
+        vector<int> zamiany_;
+        unique_ptr<PlikRoboczy> plik_;
+    };
+}
+
+#endif // LU_POZA_PAMIECIA_H
@@ -0,0 +1,169 @@
+//
+// Created by Szymon Ros on 17/10/2026.
+//
+
+#ifndef MACIERZ_H
+#define MACIERZ_H
+
+#include <cstddef>
+#include <cstdlib>
+#include <initializer_list>
+#include <new>
+#include <string>
+#include <vector>
+using namespace std;
+
+namespace biblioteka_numeryczna {
+    /**
+     * @brief Alokator zwracający pamięć wyrównaną do zadanej granicy (domyślnie linia cache, 64 B)
+     *
+     * Przykład użycia:
+     * vector<double, AlokatorWyrownany<double>> bufor(1024);
+     */
+    template <typename T, size_t Wyrownanie = 64>
+    struct AlokatorWyrownany {
+        using value_type = T;
+
+        template <typename U>
+        struct rebind {
+            using other = AlokatorWyrownany<U, Wyrownanie>;
+        };
+
+        AlokatorWyrownany() noexcept = default;
+        template <typename U>
+        AlokatorWyrownany(const AlokatorWyrownany<U, Wyrownanie>&) noexcept {}
+
+        T* allocate(size_t n) {
+            size_t bajty = (n * sizeof(T) + Wyrownanie - 1) / Wyrownanie * Wyrownanie;
+            void* p = aligned_alloc(Wyrownanie, bajty);
+            if (p == nullptr) {
+                throw bad_alloc();
+            }
+            return static_cast<T*>(p);
+        }
+
+        void deallocate(T* p, size_t) noexcept {
+            free(p);
+        }
+
+        template <typename U>
+        bool operator==(const AlokatorWyrownany<U, Wyrownanie>&) const noexcept { return true; }
+        template <typename U>
+        bool operator!=(const AlokatorWyrownany<U, Wyrownanie>&) const noexcept { return false; }
+    };
+
+    /**
+     * @brief Widok (bez kopiowania) na elementy rozmieszczone w pamięci co `krok` pozycji
+     *
+     * Wiersz macierzy to widok z krokiem 1, kolumna - widok z krokiem równym
+     * długości wiersza w buforze.
+     *
+     * Przykład użycia:
+     * Macierz A(3, 3);
+     * WidokWektora kolumna = A.kolumna(1);
+     * kolumna[2] = 5.0;   // to samo co A(2, 1) = 5.0
+     */
+    template <typename T>
+    class PodstawowyWidokWektora {
+    public:
+        PodstawowyWidokWektora(T* dane, int rozmiar, int krok)
+            : dane_(dane), rozmiar_(rozmiar), krok_(krok) {}
+
+        // widok zmienny mozna zawsze przekazac tam, gdzie oczekiwany jest widok staly
+        template <typename U>
+        PodstawowyWidokWektora(const PodstawowyWidokWektora<U>& inny)
+            : dane_(inny.dane()), rozmiar_(inny.rozmiar()), krok_(inny.krok()) {}
+
+        T& operator[](int i) const { return dane_[static_cast<ptrdiff_t>(i) * krok_]; }
+        int rozmiar() const { return rozmiar_; }
+        int krok() const { return krok_; }
+        T* dane() const { return dane_; }
+
+    private:
+        T* dane_;
+        int rozmiar_;
+        int krok_;
+    };
+
+    using WidokWektora = PodstawowyWidokWektora<double>;
+    using StalyWidokWektora = PodstawowyWidokWektora<const double>;
+
+    /**
+     * @brief Gęsta macierz przechowywana wierszami w jednym ciągłym, wyrównanym buforze
+     *
+     * Każdy wiersz zaczyna się na granicy 64 B (długość wiersza w buforze,
+     * czyli `krok()`, jest zaokrąglana w górę do wielokrotności 8 elementów),
+     * dzięki czemu pętle po wierszach są ciągłe w pamięci i dają się wektoryzować.
+     *
+     * Przykład użycia:
+     * Macierz A = {{2, 1}, {1, 3}};
+     * A(0, 1) = 4.0;
+     * double* wiersz = A.wiersz(1);
+     */
+    class Macierz {
+    public:
+        Macierz();
+        Macierz(int wiersze, int kolumny, double wartosc = 0.0);
+        explicit Macierz(const vector<vector<double>>& dane);
+        Macierz(initializer_list<initializer_list<double>> dane);
+
+        int wiersze() const { return wiersze_; }
+        int kolumny() const { return kolumny_; }
+        int krok() const { return krok_; }
+        bool pusta() const { return wiersze_ == 0 || kolumny_ == 0; }
+
+        double& operator()(int i, int j) { return bufor_[static_cast<size_t>(i) * krok_ + j]; }
+        const double& operator()(int i, int j) const { return bufor_[static_cast<size_t>(i) * krok_ + j]; }
+
+        double* wiersz(int i) { return bufor_.data() + static_cast<size_t>(i) * krok_; }
+        const double* wiersz(int i) const { return bufor_.data() + static_cast<size_t>(i) * krok_; }
+
+        double* dane() { return bufor_.data(); }
+        const double* dane() const { return bufor_.data(); }
+
+        WidokWektora widokWiersza(int i) { return WidokWektora(wiersz(i), kolumny_, 1); }
+        StalyWidokWektora widokWiersza(int i) const { return StalyWidokWektora(wiersz(i), kolumny_, 1); }
+        WidokWektora kolumna(int j) { return WidokWektora(bufor_.data() + j, wiersze_, krok_); }
+        StalyWidokWektora kolumna(int j) const { return StalyWidokWektora(bufor_.data() + j, wiersze_, krok_); }
+
+        /**
+         * @brief Zmienia wymiary macierzy; wszystkie elementy otrzymują wartość `wartosc`
+         */
+        void zmienRozmiar(int wiersze, int kolumny, double wartosc = 0.0);
+
+        /**
+         * @brief Zamienia miejscami dwa wiersze macierzy
+         */
+        void zamienWiersze(int a, int b);
+
+        /**
+         * @brief Kopiuje macierz do formatu vector<vector<double>>
+         */
+        vector<vector<double>> doWektorow() const;
+
+        /**
+         * @brief Tworzy macierz jednostkową n x n
+         */
+        static Macierz jednostkowa(int n);
+
+    private:
+        int wiersze_;
+        int kolumny_;
+        int krok_;
+        vector<double, AlokatorWyrownany<double>> bufor_;
+    };
+
+    /**
+     * @brief Mnoży macierz przez wektor (y = A * x)
+     * @param A Macierz
+     * @param x Wektor o długości A.kolumny()
+     * @return Wektor y o długości A.wiersze()
+     *
+     * Przykład użycia:
+     * Macierz A = {{2, 1}, {1, 3}};
+     * vector<double> y = pomnoz(A, {1, 1});   // {3, 4}
+     */
+    vector<double> pomnoz(const Macierz& A, const vector<double>& x);
+}
+
+#endif // MACIERZ_H
@@ -0,0 +1,89 @@
+//
+// Created by Szymon Ros on 17/10/2026.
+//
+
+#ifndef MACIERZ_PASMOWA_H
+#define MACIERZ_PASMOWA_H
+
+#include <vector>
+#include "macierz.h"
+using namespace std;
+
+namespace biblioteka_numeryczna {
+    /**
+     * @brief Kwadratowa macierz pasmowa: zapisane są tylko elementy a_ij z -dolna <= j - i <= gorna
+     *
+     * Każdy wiersz zajmuje w buforze 2 * dolna + gorna + 1 kolejnych komórek, odpowiadających
+     * kolumnom i - dolna .. i + gorna + dolna. Dodatkowe `dolna` komórek nad pasmem są zerami
+     * i mieszczą wypełnienie powstające przy rozkładzie LU z wyborem elementu głównego, więc
+     * rozkład odbywa się w miejscu. Pamięć: O(n * (2 * dolna + gorna)) zamiast O(n^2).
+     *
+     * Przykład użycia:
+     * MacierzPasmowa A(n, 1, 1);          // macierz trójprzekątniowa
+     * for (int i = 0; i < n; i++) {
+     *     A(i, i) = 2.0;
+     *     if (i > 0) A(i, i - 1) = -1.0;
+     *     if (i < n - 1) A(i, i + 1) = -1.0;
+     * }
+     */
+    class MacierzPasmowa {
+    public:
+        MacierzPasmowa();
+
+        /**
+         * @param rozmiar Wymiar n macierzy n x n
+         * @param dolna Liczba przekątnych pod główną
+         * @param gorna Liczba przekątnych nad główną
+         */
+        MacierzPasmowa(int rozmiar, int dolna, int gorna);
+
+        /**
+         * @brief Buduje macierz pasmową z gęstej; szerokości pasma są wyznaczane z niezerowych elementów
+         */
+        static MacierzPasmowa zGestej(const Macierz& A);
+
+        int rozmiar() const { return rozmiar_; }
+        int dolna() const { return dolna_; }
+        int gorna() const { return gorna_; }
+
+        /**
+         * @brief Liczba komórek bufora na wiersz (2 * dolna + gorna + 1)
+         */
+        int szerokosc() const { return szerokosc_; }
+
+        double* dane() { return dane_.data(); }
+        const double* dane() const { return dane_.data(); }
+
+        /**
+         * @brief Czy element (i, j) leży w paśmie
+         */
+        bool wPasmie(int i, int j) const { return j - i >= -dolna_ && j - i <= gorna_; }
+
+        /**
+         * @brief Element (i, j); dostęp bez sprawdzania, dozwolony dla -dolna <= j - i <= gorna + dolna
+         */
+        double& operator()(int i, int j) { return dane_[static_cast<size_t>(i) * szerokosc_ + (j - i + dolna_)]; }
+        const double& operator()(int i, int j) const { return dane_[static_cast<size_t>(i) * szerokosc_ + (j - i + dolna_)]; }
+
+        /**
+         * @brief Element (i, j); 0 poza pasmem
+         */
+        double element(int i, int j) const;
+
+        Macierz doGestej() const;
+
+    private:
+        int rozmiar_;
+        int dolna_;
+        int gorna_;
+        int szerokosc_;         // 2 * dolna + gorna + 1
+        vector<double> dane_;
+    };
+
+    /**
+     * @brief Mnoży macierz pasmową przez wektor (y = A * x), koszt O(n * (dolna + gorna))
+     */
+    vector<double> pomnoz(const MacierzPasmowa& A, const vector<double>& x);
+}
+
+#endif // MACIERZ_PASMOWA_H
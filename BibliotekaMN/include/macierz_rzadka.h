@@ -0,0 +1,175 @@
+//
+// Created by Szymon Ros on 17/10/2026.
+//
+
+#ifndef MACIERZ_RZADKA_H
+#define MACIERZ_RZADKA_H
+
+#include <vector>
+#include "macierz.h"
+using namespace std;
+
+namespace biblioteka_numeryczna {
+    /**
+     * @brief Pojedynczy niezerowy element macierzy (wiersz, kolumna, wartość)
+     */
+    struct Trojka {
+        int wiersz;
+        int kolumna;
+        double wartosc;
+    };
+
+    /**
+     * @brief Macierz rzadka w formacie CSR (compressed sparse row)
+     *
+     * Przechowywane są tylko elementy niezerowe: dla wiersza i ich kolumny to
+     * indeksyKolumn()[poczatkiWierszy()[i] .. poczatkiWierszy()[i+1]-1], posortowane rosnąco,
+     * a wartości leżą pod tymi samymi indeksami w wartosci().
+     *
+     * Przykład użycia:
+     * vector<Trojka> trojki = {{0, 0, 4}, {0, 1, -1}, {1, 0, -1}, {1, 1, 4}};
+     * MacierzRzadkaCSR A = MacierzRzadkaCSR::zTrojek(2, 2, trojki);
+     * vector<double> y = pomnoz(A, {1, 1});
+     */
+    class MacierzRzadkaCSR {
+    public:
+        MacierzRzadkaCSR();
+
+        /**
+         * @brief Tworzy macierz z gotowych tablic CSR (sprawdzana jest ich spójność)
+         */
+        MacierzRzadkaCSR(int wiersze, int kolumny,
+                         vector<int> poczatkiWierszy,
+                         vector<int> indeksyKolumn,
+                         vector<double> wartosci);
+
+        /**
+         * @brief Buduje macierz z listy trójek; powtórzone pozycje są sumowane
+         */
+        static MacierzRzadkaCSR zTrojek(int wiersze, int kolumny, vector<Trojka> trojki);
+
+        /**
+         * @brief Buduje macierz z gęstej, pomijając elementy o module nie większym niż prog
+         */
+        static MacierzRzadkaCSR zGestej(const Macierz& A, double prog = 0.0);
+        static MacierzRzadkaCSR zGestej(const vector<vector<double>>& A, double prog = 0.0);
+
+        int wiersze() const { return wiersze_; }
+        int kolumny() const { return kolumny_; }
+        int liczbaNiezerowych() const { return wartosci_.size(); }
+
+        const vector<int>& poczatkiWierszy() const { return poczatkiWierszy_; }
+        const vector<int>& indeksyKolumn() const { return indeksyKolumn_; }
+        const vector<double>& wartosci() const { return wartosci_; }
+        vector<double>& wartosci() { return wartosci_; }
+
+        /**
+         * @brief Element (i, j); 0 jeśli nie jest przechowywany
+         */
+        double element(int i, int j) const;
+
+        /**
+         * @brief Indeksy elementów przekątnej w wartosci() (-1 gdy element przekątnej nie jest zapisany)
+         */
+        vector<int> indeksyPrzekatnej() const;
+
+        Macierz doGestej() const;
+
+    private:
+        int wiersze_;
+        int kolumny_;
+        vector<int> poczatkiWierszy_;
+        vector<int> indeksyKolumn_;
+        vector<double> wartosci_;
+    };
+
+    /**
+     * @brief Mnoży macierz rzadką przez wektor (y = A * x), koszt O(nnz)
+     */
+    vector<double> pomnoz(const MacierzRzadkaCSR& A, const vector<double>& x);
+
+    /**
+     * @brief Zachłanne kolorowanie grafu macierzy: wiersze i, j są sąsiadami, gdy a_ij != 0 lub a_ji != 0
+     * @return Kolor (0, 1, ...) każdego wiersza; wiersze tego samego koloru nie zależą od siebie
+     *
+     * Wierzchołki są odwiedzane w kolejności naturalnej i dostają najmniejszy kolor
+     * niezajęty przez sąsiadów, więc liczba kolorów nie przekracza maksymalnego stopnia + 1.
+     *
+     * Przykład użycia:
+     * vector<int> kolory = kolorowanieZachlanne(A);
+     */
+    vector<int> kolorowanieZachlanne(const MacierzRzadkaCSR& A);
+
+    /**
+     * @brief Kolorowanie czerwono-czarne (szachownica) siatki nx x ny x nz numerowanej i = x + nx (y + ny z)
+     *
+     * Dla schematów 5- i 7-punktowych (sąsiedzi różnią się o 1 w jednej współrzędnej)
+     * daje poprawne kolorowanie dwoma kolorami.
+     *
+     * Przykład użycia:
+     * vector<int> kolory = kolorowanieCzerwonoCzarne(64, 64);
+     */
+    vector<int> kolorowanieCzerwonoCzarne(int nx, int ny = 1, int nz = 1);
+
+    /**
+     * @brief Sprawdza, czy żadne dwa sąsiednie wiersze nie mają tego samego koloru
+     */
+    bool poprawneKolorowanie(const MacierzRzadkaCSR& A, const vector<int>& kolory);
+
+    /**
+     * @brief Graf macierzy A + A^T bez pętli: sąsiedzi wierzchołka i to sasiedzi[poczatki[i] .. poczatki[i+1]-1], rosnąco
+     */
+    void grafSymetryczny(const MacierzRzadkaCSR& A, vector<int>& poczatki, vector<int>& sasiedzi);
+
+    /**
+     * @brief Uporządkowanie wierszy i kolumn zmniejszające wypełnienie rozkładu
+     */
+    enum class Uporzadkowanie {
+        Naturalne,
+        MinimalnyStopien,           // macierze ogólne
+        OdwrotneCuthillaMcKee,      // macierze pasmowe (zmniejsza szerokość pasma)
+        PodzialZagniezdzony         // siatki 2D / 3D
+    };
+
+    /**
+     * @brief Uporządkowanie minimalnego stopnia na grafie ilorazowym (jak AMD)
+     * @return Permutacja: permutacja[k] to wiersz A eliminowany jako k-ty
+     *
+     * Wyeliminowane wierzchołki są zastępowane "elementami" (klikami ich sąsiadów), więc pamięć
+     * nie rośnie z wypełnieniem; elementy sąsiadujące z eliminowanym wierzchołkiem są przez niego
+     * wchłaniane. W przeciwieństwie do AMD stopnie są liczone dokładnie, bez superzmiennych.
+     *
+     * Przykład użycia:
+     * vector<int> p = uporzadkowanieMinimalnegoStopnia(A);
+     */
+    vector<int> uporzadkowanieMinimalnegoStopnia(const MacierzRzadkaCSR& A);
+
+    /**
+     * @brief Odwrócone uporządkowanie Cuthilla-McKee (RCM)
+     * @return Permutacja: permutacja[k] to wiersz A na pozycji k
+     *
+     * Przeszukiwanie wszerz od wierzchołka pseudoperyferyjnego każdej składowej, sąsiedzi
+     * w kolejności rosnącego stopnia. Elementy niezerowe skupiają się przy przekątnej, więc
+     * wypełnienie rozkładu nie wychodzi poza (zmniejszony) profil macierzy.
+     */
+    vector<int> uporzadkowanieOdwrotneCuthillaMcKee(const MacierzRzadkaCSR& A);
+
+    /**
+     * @brief Uporządkowanie podziału zagnieżdżonego (nested dissection)
+     * @param minimalnyRozmiar Części nie większe niż ta liczba nie są dalej dzielone
+     * @return Permutacja: permutacja[k] to wiersz A na pozycji k
+     *
+     * Graf jest dzielony separatorem - środkowym poziomem struktury poziomów przeszukiwania
+     * wszerz od wierzchołka pseudoperyferyjnego; obie części są porządkowane rekurencyjnie,
+     * a separator trafia na koniec. Dla siatki k x k daje wypełnienie O(n log n) zamiast O(n^1.5)
+     * uporządkowań pasmowych.
+     */
+    vector<int> uporzadkowaniePodzialuZagniezdzonego(const MacierzRzadkaCSR& A, int minimalnyRozmiar = 64);
+
+    /**
+     * @brief Wybiera jedno z powyższych uporządkowań
+     */
+    vector<int> wyznaczUporzadkowanie(const MacierzRzadkaCSR& A, Uporzadkowanie rodzaj);
+}
+
+#endif // MACIERZ_RZADKA_H
@@ -0,0 +1,128 @@
+//
+// Created by Szymon Ros on 17/10/2026.
+//
+
+#ifndef PAMIEC_ROZKLADOW_H
+#define PAMIEC_ROZKLADOW_H
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include "macierz.h"
+#include "uklady_liniowe.h"
+using namespace std;
+
+namespace biblioteka_numeryczna {
+    /**
+     * @brief Skrót zawartości macierzy (wymiary i bity wszystkich elementów), 128 bitów
+     *
+     * Dwie niezależne funkcje mieszające po 64 bity, więc przypadkowa kolizja jest praktycznie
+     * wykluczona. Koszt O(n^2) - pomijalny wobec O(n^3) rozkładu.
+     */
+    struct SkrotMacierzy {
+        uint64_t h1;
+        uint64_t h2;
+
+        bool operator==(const SkrotMacierzy& inny) const { return h1 == inny.h1 && h2 == inny.h2; }
+
+        static SkrotMacierzy oblicz(const Macierz& A);
+    };
+
+    /**
+     * @brief Pamięć podręczna rozkładów LU (LRU) z kluczem będącym skrótem zawartości macierzy
+     *
+     * Przy powtarzających się macierzach (np. te same pliki plikA/B/C.txt z różnymi prawymi
+     * stronami) rozkład O(n^3) wykonywany jest raz, a kolejne rozwiązania kosztują O(n^2).
+     * Gdy suma rozmiarów rozkładów przekracza limit, usuwane są najdawniej używane.
+     * Rozkład większy niż cały limit jest zwracany, ale nie jest zapamiętywany.
+     * Wszystkie metody są bezpieczne wielowątkowo.
+     *
+     * Po włączeniu przez ustawPamiecRozkladow z pamięci korzystają rozwiazUkladLU
+     * i eliminacjaGaussa.
+     *
+     * Przykład użycia:
+     * PamiecRozkladow pamiec(size_t(512) << 20);
+     * PamiecRozkladow* poprzednia = ustawPamiecRozkladow(&pamiec);
+     * for (const vector<double>& b : praweStrony) {
+     *     auto [y, x] = rozwiazUkladLU(A, b);      // rozkład tylko przy pierwszym wywołaniu
+     * }
+     * ustawPamiecRozkladow(poprzednia);
+     */
+    class PamiecRozkladow {
+    public:
+        explicit PamiecRozkladow(size_t limitBajtow = size_t(256) << 20);
+
+        PamiecRozkladow(const PamiecRozkladow&) = delete;
+        PamiecRozkladow& operator=(const PamiecRozkladow&) = delete;
+
+        /**
+         * @brief Zwraca rozkład A z pamięci albo wykonuje go i zapamiętuje
+         *
+         * Dla macierzy osobliwej rzuca runtime_error (jak RozkladLU); nic nie jest zapamiętywane.
+         */
+        shared_ptr<const RozkladLU> rozklad(const Macierz& A);
+
+        /**
+         * @brief Usuwa rozkład A (np. po zmianie pliku z macierzą); false, gdy go nie było
+         */
+        bool uniewaznij(const Macierz& A);
+
+        /**
+         * @brief Usuwa wszystkie rozkłady; liczniki pozostają bez zmian
+         */
+        void wyczysc();
+
+        /**
+         * @brief Zmienia limit pamięci, usuwając w razie potrzeby najdawniej używane rozkłady
+         */
+        void ustawLimit(size_t limitBajtow);
+
+        size_t limit() const;
+        size_t zajetaPamiec() const;
+        size_t liczbaRozkladow() const;
+        size_t trafienia() const;
+        size_t chybienia() const;
+        size_t usuniete() const;
+
+    private:
+        struct Wpis {
+            SkrotMacierzy skrot;
+            shared_ptr<const RozkladLU> rozklad;
+            size_t bajty;
+        };
+
+        struct HashSkrotu {
+            size_t operator()(const SkrotMacierzy& s) const { return static_cast<size_t>(s.h1); }
+        };
+
+        void ograniczDoLimitu();
+
+        mutable mutex blokada_;
+        size_t limit_;
+        size_t zajete_ = 0;
+        size_t trafienia_ = 0;
+        size_t chybienia_ = 0;
+        size_t usuniete_ = 0;
+        list<Wpis> kolejnosc_;      // od ostatnio używanego
+        unordered_map<SkrotMacierzy, list<Wpis>::iterator, HashSkrotu> indeks_;
+    };
+
+    /**
+     * @brief Ustawia pamięć rozkładów używaną przez rozwiazUkladLU i eliminacjaGaussa
+     * @param pamiec Pamięć (musi żyć, dopóki jest aktywna); nullptr wyłącza (domyślnie)
+     * @return Poprzednio aktywna pamięć
+     *
+     * Przy włączonej pamięci eliminacjaGaussa nie modyfikuje przekazanych A i b.
+     */
+    PamiecRozkladow* ustawPamiecRozkladow(PamiecRozkladow* pamiec);
+
+    /**
+     * @brief Aktywna pamięć rozkładów albo nullptr
+     */
+    PamiecRozkladow* pamiecRozkladow();
+}
+
+#endif // PAMIEC_ROZKLADOW_H
@@ -0,0 +1,52 @@
+//
+// Created by Szymon Ros on 17/10/2026.
+//
+
+#ifndef PLIK_MAPOWANY_H
+#define PLIK_MAPOWANY_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+using namespace std;
+
+namespace biblioteka_numeryczna {
+    /**
+     * @brief Plik zmapowany do pamięci tylko do odczytu (bez kopiowania do bufora programu)
+     *
+     * Na systemach POSIX używa mmap, więc strony pliku są wczytywane przez system dopiero
+     * przy dostępie; na pozostałych platformach plik jest wczytywany jednym odczytem.
+     * Dla nieistniejącego lub niedostępnego pliku konstruktor rzuca runtime_error.
+     *
+     * Przykład użycia:
+     * PlikMapowany plik("plikA.txt");
+     * string_view tekst = plik.tekst();
+     */
+    class PlikMapowany {
+    public:
+        explicit PlikMapowany(const string& sciezka);
+        ~PlikMapowany();
+
+        PlikMapowany(const PlikMapowany&) = delete;
+        PlikMapowany& operator=(const PlikMapowany&) = delete;
+        PlikMapowany(PlikMapowany&& inny) noexcept;
+        PlikMapowany& operator=(PlikMapowany&& inny) noexcept;
+
+        const char* dane() const { return dane_; }
+        size_t rozmiar() const { return rozmiar_; }
+        string_view tekst() const { return string_view(dane_, rozmiar_); }
+        const string& sciezka() const { return sciezka_; }
+
+    private:
+        void zwolnij() noexcept;
+
+        string sciezka_;
+        const char* dane_ = nullptr;
+        size_t rozmiar_ = 0;
+        bool zmapowany_ = false;
+        vector<char> bufor_;        // używany, gdy mmap jest niedostępne
+    };
+}
+
+#endif // PLIK_MAPOWANY_H
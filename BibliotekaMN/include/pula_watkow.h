@@ -0,0 +1,126 @@
+//
+// Created by Szymon Ros on 17/10/2026.
+//
+
+#ifndef PULA_WATKOW_H
+#define PULA_WATKOW_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+using namespace std;
+
+namespace biblioteka_numeryczna {
+    /**
+     * @brief Pula wątków z kradzieżą zadań (work stealing)
+     *
+     * Każdy wątek ma własną kolejkę: zadania dodane z wnętrza zadania trafiają na koniec
+     * kolejki bieżącego wątku i są przez niego pobierane od końca (LIFO - dane są jeszcze
+     * w cache), a bezczynne wątki podkradają zadania z początku cudzych kolejek.
+     *
+     * Przykład użycia:
+     * PulaWatkow pula(8);
+     * for (int i = 0; i < 100; i++) {
+     *     pula.dodaj([i] { obliczBlok(i); });
+     * }
+     * pula.czekaj();
+     */
+    class PulaWatkow {
+    public:
+        /**
+         * @param liczbaWatkow Liczba wątków roboczych (0 - tyle, ile rdzeni sprzętowych)
+         */
+        explicit PulaWatkow(int liczbaWatkow = 0);
+        ~PulaWatkow();
+
+        PulaWatkow(const PulaWatkow&) = delete;
+        PulaWatkow& operator=(const PulaWatkow&) = delete;
+
+        int liczbaWatkow() const { return watki_.size(); }
+
+        /**
+         * @brief Dodaje zadanie do wykonania (można wołać także z wnętrza zadania)
+         */
+        void dodaj(function<void()> zadanie);
+
+        /**
+         * @brief Czeka na zakończenie wszystkich dodanych zadań, także tych dodanych w trakcie
+         *
+         * Jeśli któreś zadanie rzuciło wyjątek, pierwszy z nich jest tu rzucany ponownie.
+         * Nie wolno wołać z wnętrza zadania.
+         */
+        void czekaj();
+
+    private:
+        struct Kolejka {
+            mutex blokada;
+            deque<function<void()>> zadania;
+        };
+
+        void petlaWatku(int indeks);
+        bool pobierz(int indeks, function<void()>& zadanie);
+
+        vector<unique_ptr<Kolejka>> kolejki_;
+        vector<thread> watki_;
+        mutex blokadaStanu_;
+        condition_variable jestPraca_;
+        condition_variable wszystkoGotowe_;
+        atomic<int> wKolejkach_{0};
+        atomic<int> niezakonczone_{0};
+        atomic<unsigned> nastepnaKolejka_{0};
+        exception_ptr pierwszyBlad_;
+        bool koniec_ = false;
+    };
+
+    /**
+     * @brief Graf zależności zadań wykonywany na puli wątków
+     *
+     * Zadanie startuje dopiero, gdy zakończą się wszystkie jego poprzedniki. Jeśli
+     * któreś zadanie rzuci wyjątek, pozostałe nie są już wykonywane, a wyjątek
+     * jest rzucany ponownie z wykonaj().
+     *
+     * Przykład użycia:
+     * GrafZadan graf;
+     * int a = graf.dodajZadanie([] { przygotuj(); });
+     * int b = graf.dodajZadanie([] { policz(); });
+     * graf.dodajZaleznosc(a, b);          // b dopiero po a
+     * graf.wykonaj(pula);
+     */
+    class GrafZadan {
+    public:
+        /**
+         * @brief Dodaje zadanie do grafu
+         * @return Identyfikator zadania (do dodajZaleznosc)
+         */
+        int dodajZadanie(function<void()> zadanie);
+
+        /**
+         * @brief Zadanie `nastepnik` wystartuje dopiero po zakończeniu `poprzednik`
+         */
+        void dodajZaleznosc(int poprzednik, int nastepnik);
+
+        int liczbaZadan() const { return wezly_.size(); }
+
+        /**
+         * @brief Wykonuje wszystkie zadania z zachowaniem zależności i czeka na ich zakończenie
+         */
+        void wykonaj(PulaWatkow& pula);
+
+    private:
+        struct Wezel {
+            function<void()> zadanie;
+            vector<int> nastepniki;
+            int liczbaPoprzednikow = 0;
+        };
+
+        vector<Wezel> wezly_;
+    };
+}
+
+#endif // PULA_WATKOW_H
@@ -0,0 +1,191 @@
+//
+// Created by Szymon Ros on 17/10/2026.
+//
+
+#ifndef ROZKLADY_RZADKIE_H
+#define ROZKLADY_RZADKIE_H
+
+#include <memory>
+#include <vector>
+#include "macierz_rzadka.h"
+#include "uklady_liniowe.h"
+using namespace std;
+
+namespace biblioteka_numeryczna {
+    /**
+     * @brief Analiza symboliczna rozkładu macierzy rzadkiej: uporządkowanie, drzewo eliminacji i wzorzec czynnika L
+     *
+     * Zależy tylko od położenia elementów niezerowych, więc jedna analiza służy wszystkim
+     * macierzom o tym samym wzorcu (np. kolejnym krokom czasowym albo iteracjom Newtona).
+     * Wzorzec L jest wyznaczany dla P (A + A^T) P^T, więc ta sama analiza obsługuje rozkład
+     * Cholesky'ego i rozkład LU bez zamian wierszy (U ma wtedy wzorzec L^T).
+     *
+     * Przykład użycia:
+     * auto analiza = make_shared<const AnalizaSymboliczna>(A, Uporzadkowanie::PodzialZagniezdzony);
+     * for (int krok = 0; krok < liczbaKrokow; krok++) {
+     *     ... // nowe wartosci() macierzy A, ten sam wzorzec
+     *     RozkladRzadkiLU lu(A, analiza);
+     *     x = lu.solve(b);
+     * }
+     */
+    class AnalizaSymboliczna {
+    public:
+        explicit AnalizaSymboliczna(const MacierzRzadkaCSR& A, Uporzadkowanie rodzaj = Uporzadkowanie::MinimalnyStopien);
+
+        /**
+         * @param permutacja Własne uporządkowanie: permutacja[k] to wiersz A na pozycji k
+         */
+        AnalizaSymboliczna(const MacierzRzadkaCSR& A, const vector<int>& permutacja);
+
+        /**
+         * @brief Czy A ma ten sam wzorzec, co macierz, dla której wykonano analizę
+         */
+        bool zgodna(const MacierzRzadkaCSR& A) const;
+
+        int rozmiar() const { return n_; }
+        const vector<int>& permutacja() const { return permutacja_; }
+        const vector<int>& rodzic() const { return rodzic_; }      // drzewo eliminacji, -1 dla korzeni
+
+        /**
+         * @brief Liczba elementów L pod przekątną (tyle samo ma U nad przekątną w rozkładzie LU)
+         */
+        int liczbaNiezerowychL() const { return poczatkiKolumnL_[n_]; }
+
+    private:
+        friend class RozkladRzadkiLU;
+        friend class RozkladRzadkiCholeskyego;
+
+        void analizuj(const MacierzRzadkaCSR& A);
+
+        int n_ = 0;
+        vector<int> permutacja_;            // nowy -> stary
+        vector<int> odwrotna_;              // stary -> nowy
+        vector<int> wzorzecPoczatki_;       // wzorzec A do sprawdzania zgodności
+        vector<int> wzorzecKolumny_;
+
+        // kolumny P A P^T: wiersz (w nowej numeracji) i indeks elementu w A.wartosci()
+        vector<int> poczatkiKolumnA_;
+        vector<int> wierszeA_;
+        vector<int> zrodlaA_;
+
+        vector<int> rodzic_;
+
+        // L pod przekątną kolumnami (wiersze rosnąco) i te same elementy wierszami
+        vector<int> poczatkiKolumnL_;
+        vector<int> wierszeL_;
+        vector<int> poczatkiWierszyL_;
+        vector<int> kolumnyWierszyL_;       // kolumny rosnąco
+        vector<int> pozycjeWierszyL_;       // indeks elementu w wierszeL_
+    };
+
+    /**
+     * @brief Rzadki rozkład P A P^T = L U z uporządkowaniem zmniejszającym wypełnienie
+     *
+     * Rozkład lewostronny (kolumna po kolumnie) na wzorcu z analizy symbolicznej, pamięć
+     * O(nnz(L)) zamiast n^2 w eliminacjaGaussa. Elementy główne są brane z przekątnej (statyczny
+     * wybór, jak w SuperLU_DIST): element o module mniejszym niż sqrt(eps) ||A||_max jest
+     * zastępowany tą wartością z zachowaniem znaku, a solve poprawia wtedy wynik iteracyjnie
+     * residuami z oryginalną macierzą (najwyżej 10 kroków). Gdy poprawianie nie osiąga
+     * dokładności, solve zgłasza ostrzeżenie przez SLEDZ, a solve_zRaportem zwraca zbiezny = false.
+     * Nadaje się do macierzy diagonalnie dominujących i innych, dla których uporządkowanie
+     * symetryczne nie trafia na małe elementy przekątnej.
+     * Dla macierzy zerowej rzuca runtime_error("Macierz jest osobliwa").
+     *
+     * Przykład użycia:
+     * MacierzRzadkaCSR A = wczytajMatrixMarket("macierz.mtx");
+     * RozkladRzadkiLU lu(A, Uporzadkowanie::MinimalnyStopien);
+     * vector<double> x = lu.solve(b);
+     */
+    class RozkladRzadkiLU {
+    public:
+        RozkladRzadkiLU(const MacierzRzadkaCSR& A, shared_ptr<const AnalizaSymboliczna> analiza);
+        explicit RozkladRzadkiLU(const MacierzRzadkaCSR& A, Uporzadkowanie rodzaj = Uporzadkowanie::MinimalnyStopien);
+
+        /**
+         * @brief Rozwiązuje Ax = b
+         */
+        vector<double> solve(const vector<double>& b) const;
+
+        /**
+         * @brief Rozwiązuje Ax = b i zwraca przebieg poprawiania iteracyjnego
+         *
+         * iteracje to liczba kroków poprawiania, residuum to ||b - Ax||_inf. Bez zaburzonych
+         * elementów głównych rozwiązanie jest bezpośrednie: iteracje = 0, zbiezny = true,
+         * a residuum nie jest liczone (0).
+         *
+         * Przykład użycia:
+         * RaportZbieznosci raport = lu.solve_zRaportem(b);
+         * if (!raport.zbiezny) { ... }     // np. rozkład gęsty z pivotingiem
+         */
+        RaportZbieznosci solve_zRaportem(const vector<double>& b) const;
+
+        int rozmiar() const { return analiza_->rozmiar(); }
+        const shared_ptr<const AnalizaSymboliczna>& analiza() const { return analiza_; }
+
+        /**
+         * @brief Liczba elementów L i U łącznie z przekątną
+         */
+        int liczbaNiezerowych() const { return 2 * analiza_->liczbaNiezerowychL() + rozmiar(); }
+
+        /**
+         * @brief Liczba elementów głównych zastąpionych z powodu zbyt małego modułu
+         */
+        int liczbaZaburzonych() const { return liczbaZaburzonych_; }
+
+    private:
+        void rozloz(const MacierzRzadkaCSR& A);
+        void rozwiazCzynnikami(vector<double>& x) const;
+
+        shared_ptr<const AnalizaSymboliczna> analiza_;
+        vector<double> L_;          // wartości pod wzorcem wierszeL_
+        vector<double> U_;          // U(k, j) dla k z wiersza j wzorca L, w kolejności kolumnyWierszyL_
+        vector<double> przekatna_;  // przekątna U
+        int liczbaZaburzonych_ = 0;
+        MacierzRzadkaCSR A_;        // kopia A tylko przy zaburzonych elementach głównych
+    };
+
+    /**
+     * @brief Rzadki rozkład Cholesky'ego P A P^T = L L^T macierzy symetrycznej dodatnio określonej
+     *
+     * A musi być zapisana w całości (oba trójkąty), używany jest jej dolny trójkąt po permutacji.
+     * Jak RozkladCholeskyego nie rzuca wyjątku przy macierzy nieokreślonej dodatnio: status()
+     * zwraca NieDodatnioOkreslona, a kolumnaBledu() wskazuje wiersz A (w oryginalnej numeracji).
+     *
+     * Przykład użycia (siatka 2D):
+     * auto analiza = make_shared<const AnalizaSymboliczna>(A, Uporzadkowanie::PodzialZagniezdzony);
+     * RozkladRzadkiCholeskyego chol(A, analiza);
+     * if (chol.poprawny()) {
+     *     vector<double> x = chol.solve(b);
+     * }
+     */
+    class RozkladRzadkiCholeskyego {
+    public:
+        RozkladRzadkiCholeskyego(const MacierzRzadkaCSR& A, shared_ptr<const AnalizaSymboliczna> analiza);
+        explicit RozkladRzadkiCholeskyego(const MacierzRzadkaCSR& A,
+                                          Uporzadkowanie rodzaj = Uporzadkowanie::MinimalnyStopien);
+
+        StatusRozkladu status() const { return status_; }
+        bool poprawny() const { return status_ == StatusRozkladu::Poprawny; }
+        int kolumnaBledu() const { return kolumnaBledu_; }
+
+        /**
+         * @brief Rozwiązuje Ax = b; dla nieudanego rozkładu rzuca runtime_error
+         */
+        vector<double> solve(const vector<double>& b) const;
+
+        int rozmiar() const { return analiza_->rozmiar(); }
+        const shared_ptr<const AnalizaSymboliczna>& analiza() const { return analiza_; }
+        int liczbaNiezerowych() const { return analiza_->liczbaNiezerowychL() + rozmiar(); }
+
+    private:
+        void rozloz(const MacierzRzadkaCSR& A);
+
+        shared_ptr<const AnalizaSymboliczna> analiza_;
+        vector<double> L_;          // wartości pod wzorcem wierszeL_
+        vector<double> przekatna_;  // przekątna L
+        StatusRozkladu status_ = StatusRozkladu::Poprawny;
+        int kolumnaBledu_ = -1;
+    };
+}
+
+#endif // ROZKLADY_RZADKIE_H
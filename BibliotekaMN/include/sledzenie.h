@@ -0,0 +1,120 @@
+//
+// Created by Szymon Ros on 17/10/2026.
+//
+
+#ifndef SLEDZENIE_H
+#define SLEDZENIE_H
+
+#include <string>
+#include <vector>
+#include "macierz.h"
+using namespace std;
+
+namespace biblioteka_numeryczna {
+    /**
+     * @brief Odbiorca komunikatów diagnostycznych wysyłanych przez jądra numeryczne
+     *
+     * Jądra (rozkład LU, podstawianie, sprawdzanie residuum, sprowadzanie do postaci
+     * schodkowej) nie piszą same na cout - zgłaszają postęp do aktywnego odbiorcy.
+     * Domyślny odbiorca (SledzenieWylaczone) ignoruje wszystko i zgłasza wlaczone() == false,
+     * więc jądra nie formatują nawet tekstu komunikatów.
+     *
+     * Przykład użycia:
+     * SledzenieKonsola konsola;
+     * ustawSledzenie(&konsola);      // dawne wypisywanie na cout
+     * rozwiazUkladLU(A, b);
+     * ustawSledzenie(nullptr);       // z powrotem cisza
+     */
+    class Sledzenie {
+    public:
+        virtual ~Sledzenie() = default;
+
+        /**
+         * @brief Czy odbiorca chce dostawać komunikaty (jądra pomijają formatowanie, gdy nie)
+         */
+        virtual bool wlaczone() const { return true; }
+
+        virtual void komunikat(const string& tekst) = 0;
+        virtual void ostrzezenie(const string& tekst) = 0;
+        virtual void macierz(const Macierz& macierz, const string& nazwa) = 0;
+        virtual void wektor(const vector<double>& wektor, const string& nazwa) = 0;
+    };
+
+    /**
+     * @brief Odbiorca pusty - domyślny, nic nie robi
+     */
+    class SledzenieWylaczone : public Sledzenie {
+    public:
+        bool wlaczone() const override { return false; }
+        void komunikat(const string&) override {}
+        void ostrzezenie(const string&) override {}
+        void macierz(const Macierz&, const string&) override {}
+        void wektor(const vector<double>&, const string&) override {}
+    };
+
+    /**
+     * @brief Odbiorca wypisujący komunikaty na cout (ostrzeżenia na cerr) w dotychczasowym formacie
+     */
+    class SledzenieKonsola : public Sledzenie {
+    public:
+        void komunikat(const string& tekst) override;
+        void ostrzezenie(const string& tekst) override;
+        void macierz(const Macierz& macierz, const string& nazwa) override;
+        void wektor(const vector<double>& wektor, const string& nazwa) override;
+    };
+
+    /**
+     * @brief Ustawia aktywnego odbiorcę komunikatów (nullptr przywraca odbiorcę pustego)
+     * @param sledzenie Odbiorca; musi żyć tak długo, jak długo jest aktywny
+     * @return Poprzednio aktywny odbiorca
+     *
+     * Przykład użycia:
+     * SledzenieKonsola konsola;
+     * Sledzenie* poprzednie = ustawSledzenie(&konsola);
+     * ...
+     * ustawSledzenie(poprzednie);
+     */
+    Sledzenie* ustawSledzenie(Sledzenie* sledzenie);
+
+    /**
+     * @brief Zwraca aktywnego odbiorcę komunikatów
+     */
+    Sledzenie& sledzenie();
+
+    /**
+     * @brief Ustawia odbiorcę na czas życia obiektu; destruktor przywraca poprzedniego także przy wyjątku
+     *
+     * Przykład użycia:
+     * SledzenieKonsola konsola;
+     * ZakresSledzenia zakres(&konsola);
+     * rozwiazUkladLU(A, b);      // komunikaty na konsolę
+     */
+    class ZakresSledzenia {
+    public:
+        explicit ZakresSledzenia(Sledzenie* sledzenie) : poprzednie_(ustawSledzenie(sledzenie)) {}
+        ~ZakresSledzenia() { ustawSledzenie(poprzednie_); }
+
+        ZakresSledzenia(const ZakresSledzenia&) = delete;
+        ZakresSledzenia& operator=(const ZakresSledzenia&) = delete;
+
+    private:
+        Sledzenie* poprzednie_;
+    };
+}
+
+// Zgłoszenie do aktywnego odbiorcy, np. SLEDZ(komunikat("Iteracja " + to_string(k + 1)));
+// Argumenty są wyliczane tylko wtedy, gdy odbiorca jest włączony. Zdefiniowanie
+// BIBLIOTEKA_MN_BEZ_SLEDZENIA (opcja CMake BIBLIOTEKA_MN_SLEDZENIE=OFF) usuwa śledzenie z kodu całkowicie.
+#ifdef BIBLIOTEKA_MN_BEZ_SLEDZENIA
+#define SLEDZ(wywolanie) do {} while (0)
+#else
+#define SLEDZ(wywolanie) \
+    do { \
+        ::biblioteka_numeryczna::Sledzenie& sledzenie_ = ::biblioteka_numeryczna::sledzenie(); \
+        if (sledzenie_.wlaczone()) { \
+            sledzenie_.wywolanie; \
+        } \
+    } while (0)
+#endif
+
+#endif // SLEDZENIE_H
@@ -5,7 +5,14 @@
 #ifndef UKLADY_LINIOWE_H
 #define UKLADY_LINIOWE_H
 
+#include <functional>
+#include <string>
 #include <vector>
+#include "macierz.h"
+#include "macierz_rzadka.h"
+#include "macierz_pasmowa.h"
+#include "format_binarny.h"
+#include "pula_watkow.h"
 using namespace std;
 
 namespace biblioteka_numeryczna {
@@ -23,15 +30,34 @@ namespace biblioteka_numeryczna {
     vector<double> eliminacjaGaussa(vector<vector<double>>& macierz_A,
                                    vector<double>& wektor_b);
 
+    /**
+     * @brief Eliminacja Gaussa na macierzy w ciągłym buforze
+     * @param macierz_A Macierz współczynników n x n (zostanie zmodyfikowana)
+     * @param wektor_b Wektor wyrazów wolnych (zostanie zmodyfikowany)
+     * @return Wektor rozwiązań
+     *
+     * Gdy włączona jest pamięć rozkładów (ustawPamiecRozkladow), rozwiązanie jest liczone
+     * z zapamiętanego rozkładu LU, a macierz_A i wektor_b pozostają niezmienione.
+     *
+     * Przykład użycia:
+     * Macierz A = {{2, 1}, {1, 3}};
+     * vector<double> b = {3, 4};
+     * vector<double> rozwiazanie = eliminacjaGaussa(A, b);
+     */
+    vector<double> eliminacjaGaussa(Macierz& macierz_A,
+                                   vector<double>& wektor_b);
+
     /**
      * @brief Rozwiązuje układ równań metodą Gaussa-Seidela
      * @param macierz_A Macierz współczynników
      * @param wektor_b Wektor wyrazów wolnych
      * @param przyblizenie_poczatkowe Przybliżenie początkowe
-     * @param tolerancja Tolerancja błędu
+     * @param tolerancja Próg sumy |x_nowe - x| w jednym przebiegu
      * @param max_iteracji Maksymalna liczba iteracji
      * @return Wektor rozwiązań
      *
+     * Wersja z KryteriumZbieznosci zwraca raport z liczbą iteracji, residuum i czasem przebiegu.
+     *
      * Przykład użycia:
      * vector<vector<double>> A = {{4, 1}, {1, 3}};
      * vector<double> b = {5, 4};
@@ -44,6 +70,351 @@ namespace biblioteka_numeryczna {
                                       double tolerancja = 1e-6,
                                       int max_iteracji = 1000);
 
+    /**
+     * @brief Metoda Gaussa-Seidela dla macierzy w ciągłym buforze
+     *
+     * Przykład użycia:
+     * Macierz A = {{4, 1}, {1, 3}};
+     * vector<double> rozwiazanie = metodaGaussaSeidela(A, {5, 4}, {0, 0});
+     */
+    vector<double> metodaGaussaSeidela(const Macierz& macierz_A,
+                                      const vector<double>& wektor_b,
+                                      const vector<double>& przyblizenie_poczatkowe,
+                                      double tolerancja = 1e-6,
+                                      int max_iteracji = 1000);
+
+    /**
+     * @brief Metoda Gaussa-Seidela dla macierzy rzadkiej CSR
+     * @param macierz_A Macierz współczynników (niezerowa przekątna)
+     * @param wektor_b Wektor wyrazów wolnych
+     * @param przyblizenie_poczatkowe Przybliżenie początkowe
+     * @param tolerancja Próg sumy |x_nowe - x| w jednym przebiegu
+     * @param max_iteracji Maksymalna liczba iteracji
+     * @return Wektor rozwiązań
+     *
+     * Przebieg odwiedza tylko zapisane elementy, więc kosztuje O(nnz) zamiast O(n^2).
+     *
+     * Przykład użycia:
+     * MacierzRzadkaCSR A = MacierzRzadkaCSR::zTrojek(n, n, trojki);
+     * vector<double> rozwiazanie = metodaGaussaSeidela(A, b, vector<double>(n, 0.0));
+     */
+    vector<double> metodaGaussaSeidela(const MacierzRzadkaCSR& macierz_A,
+                                      const vector<double>& wektor_b,
+                                      const vector<double>& przyblizenie_poczatkowe,
+                                      double tolerancja = 1e-6,
+                                      int max_iteracji = 1000);
+
+    /**
+     * @brief Równoległa metoda Gaussa-Seidela z kolorowaniem wierszy
+     * @param macierz_A Macierz współczynników (niezerowa przekątna)
+     * @param wektor_b Wektor wyrazów wolnych
+     * @param przyblizenie_poczatkowe Przybliżenie początkowe
+     * @param kolory Kolor każdego wiersza (kolorowanieZachlanne, kolorowanieCzerwonoCzarne)
+     * @param pula Pula wątków, na której są aktualizowane wiersze jednego koloru
+     * @param tolerancja Próg sumy |x_nowe - x| w jednym przebiegu (jak w metodaGaussaSeidela)
+     * @param max_iteracji Maksymalna liczba iteracji
+     * @return Wektor rozwiązań
+     *
+     * Przebieg aktualizuje kolejno klasy kolorów; wiersze jednej klasy nie zależą od siebie,
+     * więc są liczone równolegle, a wynik nie zależy od liczby wątków. Odpowiada to metodzie
+     * Gaussa-Seidela z wierszami uporządkowanymi według kolorów.
+     *
+     * Przykład użycia:
+     * vector<double> x = metodaGaussaSeidelaKolorowa(A, b, vector<double>(n, 0.0),
+     *                                                kolorowanieZachlanne(A), pula);
+     */
+    vector<double> metodaGaussaSeidelaKolorowa(const MacierzRzadkaCSR& macierz_A,
+                                               const vector<double>& wektor_b,
+                                               const vector<double>& przyblizenie_poczatkowe,
+                                               const vector<int>& kolory,
+                                               PulaWatkow& pula,
+                                               double tolerancja = 1e-6,
+                                               int max_iteracji = 1000);
+
+    /**
+     * @brief Jak wyżej, z własną pulą wątków (liczbaWatkow = 0 - tyle, ile rdzeni)
+     */
+    vector<double> metodaGaussaSeidelaKolorowa(const MacierzRzadkaCSR& macierz_A,
+                                               const vector<double>& wektor_b,
+                                               const vector<double>& przyblizenie_poczatkowe,
+                                               const vector<int>& kolory,
+                                               double tolerancja = 1e-6,
+                                               int max_iteracji = 1000,
+                                               int liczbaWatkow = 0);
+
+    /**
+     * @brief Metoda Jacobiego dla macierzy rzadkiej CSR (cały przebieg liczony z poprzedniego przybliżenia)
+     *
+     * Przykład użycia:
+     * vector<double> rozwiazanie = metodaJacobiego(A, b, vector<double>(n, 0.0));
+     */
+    vector<double> metodaJacobiego(const MacierzRzadkaCSR& macierz_A,
+                                   const vector<double>& wektor_b,
+                                   const vector<double>& przyblizenie_poczatkowe,
+                                   double tolerancja = 1e-6,
+                                   int max_iteracji = 1000);
+
+    /**
+     * @brief Metoda nadrelaksacji (SOR) dla macierzy rzadkiej CSR
+     * @param omega Parametr relaksacji z przedziału (0, 2); omega = 1 to metoda Gaussa-Seidela
+     *
+     * Przykład użycia:
+     * vector<double> rozwiazanie = metodaSOR(A, b, vector<double>(n, 0.0), 1.5);
+     */
+    vector<double> metodaSOR(const MacierzRzadkaCSR& macierz_A,
+                             const vector<double>& wektor_b,
+                             const vector<double>& przyblizenie_poczatkowe,
+                             double omega,
+                             double tolerancja = 1e-6,
+                             int max_iteracji = 1000);
+
+    /**
+     * @brief Operator liniowy podany jako funkcja y = A * x (bez jawnej macierzy)
+     *
+     * Przykład użycia:
+     * OperatorLiniowy A = [](const vector<double>& x, vector<double>& y) {
+     *     for (size_t i = 0; i < x.size(); i++) y[i] = 2 * x[i];
+     * };
+     */
+    using OperatorLiniowy = function<void(const vector<double>& x, vector<double>& y)>;
+
+    /**
+     * @brief Prekondycjoner: z = M^-1 * r; pusta funkcja oznacza brak prekondycjonowania
+     */
+    using Prekondycjoner = function<void(const vector<double>& r, vector<double>& z)>;
+
+    /**
+     * @brief Operator liniowy mnożący przez macierz (macierz musi żyć dłużej niż operator)
+     */
+    OperatorLiniowy operatorMacierzy(const Macierz& A);
+    OperatorLiniowy operatorMacierzy(const MacierzRzadkaCSR& A);
+
+    /**
+     * @brief Operator liniowy na widoku pliku binarnego - mnożenie czyta zmapowane dane bez kopiowania
+     *
+     * Widok jest kopiowany do operatora, ale plik (PlikBinarny) musi żyć dłużej niż operator.
+     *
+     * Przykład użycia:
+     * PlikBinarny plik("uklad.bmn");
+     * RaportZbieznosci wynik = metodaGradientowSprzezonych(operatorMacierzy(plik.macierzCSR()), plik.wektor(), x0);
+     */
+    OperatorLiniowy operatorMacierzy(const WidokMacierzy& A);
+    OperatorLiniowy operatorMacierzy(const WidokCSR& A);
+    OperatorLiniowy operatorMacierzy(const WidokPasmowy& A);
+
+    /**
+     * @brief Warunki zatrzymania metod iteracyjnych
+     *
+     * Iteracja kończy się, gdy ||r|| <= tolerancjaBezwzgledna albo
+     * ||r|| / ||b|| <= tolerancjaWzgledna (normy euklidesowe), lub po max_iteracji.
+     * Metody stacjonarne (Gauss-Seidel, SOR) kończą także, gdy suma |x_nowe - x|
+     * w jednym przebiegu spadnie poniżej tolerancjaKroku.
+     */
+    struct KryteriumZbieznosci {
+        double tolerancjaWzgledna = 1e-8;
+        double tolerancjaBezwzgledna = 0.0;
+        int max_iteracji = 1000;
+        double tolerancjaKroku = 0.0;
+    };
+
+    /**
+     * @brief Wynik metody iteracyjnej z przebiegiem zbieżności
+     */
+    struct RaportZbieznosci {
+        vector<double> x;                     // rozwiązanie
+        int iteracje = 0;                     // liczba wykonanych iteracji
+        double residuum = 0.0;                // ||b - Ax|| po ostatniej iteracji
+        double residuumWzgledne = 0.0;        // residuum / ||b||
+        vector<double> historiaResiduum;      // ||r_k|| dla k = 0..iteracje
+        bool zbiezny = false;                 // czy spełniono kryterium przed max_iteracji
+        double czasNaIteracje = 0.0;          // średni czas jednej iteracji [s]
+    };
+
+    /**
+     * @brief Raport metody SOR z doborem parametru relaksacji
+     */
+    struct RaportSOR : RaportZbieznosci {
+        double omega = 1.0;                   // parametr relaksacji w ostatnim przebiegu
+        vector<double> historiaOmega;         // omega użyte w kolejnych przebiegach
+    };
+
+    /**
+     * @brief Prekondycjoner Jacobiego (odwrotność przekątnej)
+     *
+     * Przykład użycia:
+     * Prekondycjoner M = prekondycjonerJacobiego(A);
+     */
+    Prekondycjoner prekondycjonerJacobiego(const MacierzRzadkaCSR& A);
+    Prekondycjoner prekondycjonerJacobiego(const Macierz& A);
+
+    /**
+     * @brief Prekondycjoner SSOR (symetryczna nadrelaksacja) dla macierzy symetrycznej
+     * @param omega Parametr relaksacji z przedziału (0, 2)
+     */
+    Prekondycjoner prekondycjonerSSOR(const MacierzRzadkaCSR& A, double omega = 1.0);
+
+    /**
+     * @brief Niepełny rozkład Cholesky'ego IC(0) - czynnik L ma wzorzec dolnego trójkąta A
+     *
+     * Gdy rozkład się załamuje (ujemny element na przekątnej), jest powtarzany dla
+     * A + alfa * diag(A) z rosnącym alfa.
+     */
+    Prekondycjoner prekondycjonerCholeskyNiepelny(const MacierzRzadkaCSR& A);
+
+    /**
+     * @brief Metoda gradientów sprzężonych z prekondycjonowaniem dla macierzy symetrycznych dodatnio określonych
+     * @param A Operator y = A * x (symetryczny, dodatnio określony)
+     * @param wektor_b Wektor wyrazów wolnych
+     * @param przyblizenie_poczatkowe Przybliżenie początkowe
+     * @param kryterium Warunki zatrzymania
+     * @param M Prekondycjoner (pusty - bez prekondycjonowania)
+     * @return Raport z rozwiązaniem i historią residuum
+     *
+     * Jeśli w trakcie okaże się, że operator nie jest dodatnio określony (p^T A p <= 0),
+     * iteracja się kończy, a raport ma zbiezny == false.
+     *
+     * Przykład użycia:
+     * MacierzRzadkaCSR A = MacierzRzadkaCSR::zTrojek(n, n, trojki);
+     * RaportZbieznosci wynik = metodaGradientowSprzezonych(A, b, vector<double>(n, 0.0),
+     *                                                      {1e-10, 0.0, 500},
+     *                                                      prekondycjonerCholeskyNiepelny(A));
+     */
+    RaportZbieznosci metodaGradientowSprzezonych(const OperatorLiniowy& A,
+                                                 const vector<double>& wektor_b,
+                                                 const vector<double>& przyblizenie_poczatkowe,
+                                                 const KryteriumZbieznosci& kryterium = {},
+                                                 const Prekondycjoner& M = nullptr);
+    RaportZbieznosci metodaGradientowSprzezonych(const MacierzRzadkaCSR& A,
+                                                 const vector<double>& wektor_b,
+                                                 const vector<double>& przyblizenie_poczatkowe,
+                                                 const KryteriumZbieznosci& kryterium = {},
+                                                 const Prekondycjoner& M = nullptr);
+    RaportZbieznosci metodaGradientowSprzezonych(const Macierz& A,
+                                                 const vector<double>& wektor_b,
+                                                 const vector<double>& przyblizenie_poczatkowe,
+                                                 const KryteriumZbieznosci& kryterium = {},
+                                                 const Prekondycjoner& M = nullptr);
+
+    /**
+     * @brief Metoda GMRES z restartem co `restart` kroków, dla dowolnych (niesymetrycznych) układów
+     * @param A Operator y = A * x
+     * @param wektor_b Wektor wyrazów wolnych
+     * @param przyblizenie_poczatkowe Przybliżenie początkowe
+     * @param restart Długość cyklu m - pamięć to (m + 1) wektorów długości n
+     * @param kryterium Warunki zatrzymania (max_iteracji liczy kroki Arnoldiego łącznie)
+     * @param M Prekondycjoner stosowany prawostronnie (pusty - bez prekondycjonowania)
+     * @return Raport z rozwiązaniem i historią residuum
+     *
+     * Przykład użycia:
+     * RaportZbieznosci wynik = metodaGMRES(A, b, vector<double>(n, 0.0), 30,
+     *                                      {1e-10, 0.0, 2000}, prekondycjonerJacobiego(A));
+     */
+    RaportZbieznosci metodaGMRES(const OperatorLiniowy& A,
+                                 const vector<double>& wektor_b,
+                                 const vector<double>& przyblizenie_poczatkowe,
+                                 int restart = 30,
+                                 const KryteriumZbieznosci& kryterium = {},
+                                 const Prekondycjoner& M = nullptr);
+    RaportZbieznosci metodaGMRES(const MacierzRzadkaCSR& A,
+                                 const vector<double>& wektor_b,
+                                 const vector<double>& przyblizenie_poczatkowe,
+                                 int restart = 30,
+                                 const KryteriumZbieznosci& kryterium = {},
+                                 const Prekondycjoner& M = nullptr);
+    RaportZbieznosci metodaGMRES(const Macierz& A,
+                                 const vector<double>& wektor_b,
+                                 const vector<double>& przyblizenie_poczatkowe,
+                                 int restart = 30,
+                                 const KryteriumZbieznosci& kryterium = {},
+                                 const Prekondycjoner& M = nullptr);
+
+    /**
+     * @brief Metoda BiCGSTAB dla układów niesymetrycznych (pamięć: kilka wektorów długości n)
+     * @param A Operator y = A * x
+     * @param wektor_b Wektor wyrazów wolnych
+     * @param przyblizenie_poczatkowe Przybliżenie początkowe
+     * @param kryterium Warunki zatrzymania
+     * @param M Prekondycjoner stosowany prawostronnie (pusty - bez prekondycjonowania)
+     * @return Raport z rozwiązaniem i historią residuum
+     *
+     * Przy załamaniu metody (rho = 0 lub omega = 0) iteracja się kończy, a raport ma zbiezny == false.
+     *
+     * Przykład użycia:
+     * RaportZbieznosci wynik = metodaBiCGSTAB(A, b, vector<double>(n, 0.0));
+     */
+    RaportZbieznosci metodaBiCGSTAB(const OperatorLiniowy& A,
+                                    const vector<double>& wektor_b,
+                                    const vector<double>& przyblizenie_poczatkowe,
+                                    const KryteriumZbieznosci& kryterium = {},
+                                    const Prekondycjoner& M = nullptr);
+    RaportZbieznosci metodaBiCGSTAB(const MacierzRzadkaCSR& A,
+                                    const vector<double>& wektor_b,
+                                    const vector<double>& przyblizenie_poczatkowe,
+                                    const KryteriumZbieznosci& kryterium = {},
+                                    const Prekondycjoner& M = nullptr);
+    RaportZbieznosci metodaBiCGSTAB(const Macierz& A,
+                                    const vector<double>& wektor_b,
+                                    const vector<double>& przyblizenie_poczatkowe,
+                                    const KryteriumZbieznosci& kryterium = {},
+                                    const Prekondycjoner& M = nullptr);
+
+    /**
+     * @brief Metody SOR i Gaussa-Seidela z tym samym kryterium i raportem co metody Kryłowa
+     *
+     * Residuum wiersza i w chwili jego aktualizacji to a_ii * (x_nowe_i - x_i), więc norma
+     * residuum i norma kroku są zbierane w trakcie przebiegu, bez dodatkowego mnożenia A * x.
+     * Historia zawiera to residuum "w trakcie przebiegu"; raport.residuum jest liczone
+     * dokładnie, raz, dla wyniku końcowego.
+     *
+     * Przykład użycia:
+     * RaportZbieznosci wynik = metodaGaussaSeidela(A, b, vector<double>(n, 0.0), {1e-8, 0.0, 500});
+     * cout << wynik.iteracje << " iteracji, " << wynik.czasNaIteracje << " s/iterację";
+     */
+    RaportZbieznosci metodaGaussaSeidela(const Macierz& macierz_A,
+                                         const vector<double>& wektor_b,
+                                         const vector<double>& przyblizenie_poczatkowe,
+                                         const KryteriumZbieznosci& kryterium);
+    RaportZbieznosci metodaGaussaSeidela(const vector<vector<double>>& macierz_A,
+                                         const vector<double>& wektor_b,
+                                         const vector<double>& przyblizenie_poczatkowe,
+                                         const KryteriumZbieznosci& kryterium);
+
+    /**
+     * @brief Metoda SOR z automatycznym doborem omega
+     * @param macierz_A Macierz współczynników (niezerowa przekątna)
+     * @param wektor_b Wektor wyrazów wolnych
+     * @param przyblizenie_poczatkowe Przybliżenie początkowe
+     * @param kryterium Warunki zatrzymania
+     * @return Raport z rozwiązaniem, historią residuum i użytymi wartościami omega
+     *
+     * Pierwsze przebiegi to zwykły Gauss-Seidel; gdy iloraz kolejnych norm kroku się ustali,
+     * przyjmuje się go za promień spektralny rho_GS i ustawia omega = 2 / (1 + sqrt(1 - rho_GS)),
+     * optymalne dla macierzy zgodnie uporządkowanych (np. schematy różnicowe dla równania
+     * Poissona). Później obserwowana zbieżność jest porównywana z oczekiwaną (omega - 1)
+     * i w razie potrzeby omega jest zwiększane.
+     *
+     * Przykład użycia:
+     * RaportSOR wynik = metodaSORAdaptacyjna(A, b, vector<double>(n, 0.0), {1e-8, 0.0, 5000});
+     * cout << "omega = " << wynik.omega << ", iteracje: " << wynik.iteracje;
+     */
+    RaportSOR metodaSORAdaptacyjna(const MacierzRzadkaCSR& macierz_A,
+                                   const vector<double>& wektor_b,
+                                   const vector<double>& przyblizenie_poczatkowe,
+                                   const KryteriumZbieznosci& kryterium = {});
+    RaportSOR metodaSORAdaptacyjna(const Macierz& macierz_A,
+                                   const vector<double>& wektor_b,
+                                   const vector<double>& przyblizenie_poczatkowe,
+                                   const KryteriumZbieznosci& kryterium = {});
+    RaportZbieznosci metodaSOR(const MacierzRzadkaCSR& macierz_A,
+                               const vector<double>& wektor_b,
+                               const vector<double>& przyblizenie_poczatkowe,
+                               double omega,
+                               const KryteriumZbieznosci& kryterium);
+    RaportZbieznosci metodaGaussaSeidela(const MacierzRzadkaCSR& macierz_A,
+                                         const vector<double>& wektor_b,
+                                         const vector<double>& przyblizenie_poczatkowe,
+                                         const KryteriumZbieznosci& kryterium);
+
     /**
      * @brief Wczytuje dane układu równań z pliku
      * @param nazwaPliku Nazwa pliku z danymi
@@ -61,6 +432,42 @@ namespace biblioteka_numeryczna {
                     vector<vector<double>>& A,
                     vector<double>& B, int& N);
 
+    /**
+     * @brief Wczytuje układ z pliku zmapowanego do pamięci, bez kopii tekstu i bez wektora na wiersz
+     * @param nazwaPliku Ścieżka do pliku
+     * @param A Macierz współczynników (zostanie wypełniona)
+     * @param B Wektor wyrazów wolnych (zostanie wypełniony)
+     * @param N Rozmiar układu (zostanie ustawiony)
+     *
+     * Format jak w plikA.txt: dowolne linie nagłówka, "N: <n>", "b:" z n liczbami,
+     * "A:" (lub "a:"), a po niej n linii po n liczb. Liczby są parsowane przez from_chars
+     * wprost do ciągłego bufora macierzy. Przy błędnych danych rzuca runtime_error
+     * z nazwą pliku i numerem linii, np. "plikA.txt:7: oczekiwano liczby, znaleziono \"1,5\"";
+     * A, B i N pozostają wtedy niezmienione.
+     *
+     * Przykład użycia:
+     * Macierz A;
+     * vector<double> B;
+     * int N;
+     * wczytajDaneMapowane("plikA.txt", A, B, N);
+     */
+    void wczytajDaneMapowane(const string& nazwaPliku, Macierz& A, vector<double>& B, int& N);
+
+    /**
+     * @brief Wczytuje dane układu równań z pliku bezpośrednio do macierzy w ciągłym buforze
+     *
+     * Korzysta z wczytajDaneMapowane; plik jest szukany także w katalogu nadrzędnym.
+     *
+     * Przykład użycia:
+     * Macierz A;
+     * vector<double> B;
+     * int N;
+     * wczytajDane("dane.txt", A, B, N);
+     */
+    void wczytajDane(const string& nazwaPliku,
+                    Macierz& A,
+                    vector<double>& B, int& N);
+
     /**
      * @brief Tworzy macierz dopełnioną [A|b] z macierzy A i wektora b
      * @param A Macierz współczynników
@@ -77,6 +484,18 @@ namespace biblioteka_numeryczna {
                                 const vector<double>& B,
                                 vector<vector<double>>& macierzDopelniona);
 
+    /**
+     * @brief Tworzy macierz dopełnioną [A|b] w ciągłym buforze
+     *
+     * Przykład użycia:
+     * Macierz A = {{2, 1}, {1, 3}};
+     * Macierz macierzDopelniona;
+     * utworzMacierzDopelniona(A, {3, 4}, macierzDopelniona);
+     */
+    void utworzMacierzDopelniona(const Macierz& A,
+                                const vector<double>& B,
+                                Macierz& macierzDopelniona);
+
     /**
      * @brief Wyświetla macierz w czytelnej formie
      * @param macierz Macierz do wyświetlenia
@@ -89,6 +508,12 @@ namespace biblioteka_numeryczna {
     void wyswietlMacierz(const vector<vector<double>>& macierz,
                         const string& nazwa);
 
+    /**
+     * @brief Wyświetla macierz w czytelnej formie
+     */
+    void wyswietlMacierz(const Macierz& macierz,
+                        const string& nazwa);
+
     /**
      * @brief Wyświetla wektor w czytelnej formie
      * @param wektor Wektor do wyświetlenia
@@ -117,6 +542,13 @@ namespace biblioteka_numeryczna {
                         const vector<double>& B,
                         const vector<double>& X);
 
+    /**
+     * @brief Sprawdza poprawność rozwiązania przez podstawienie do równania Ax = b
+     */
+    void sprawdzWynik(const Macierz& A,
+                        const vector<double>& B,
+                        const vector<double>& X);
+
     /**
      * @brief Sprowadza macierz dopełnioną do postaci schodkowej
      * @param macierzDopelniona Macierz dopełniona (zostanie zmodyfikowana)
@@ -127,6 +559,11 @@ namespace biblioteka_numeryczna {
      */
     void sprowadzanieDoPostaciSchodkowej(vector<vector<double>>& macierzDopelniona);
 
+    /**
+     * @brief Sprowadza macierz dopełnioną (w ciągłym buforze) do postaci schodkowej
+     */
+    void sprowadzanieDoPostaciSchodkowej(Macierz& macierzDopelniona);
+
     /**
      * @brief Rozwiązuje układ równań z macierzy w postaci schodkowej metodą podstawiania wstecznego
      * @param macierzSchodkowa Macierz w postaci schodkowej
@@ -137,6 +574,12 @@ namespace biblioteka_numeryczna {
      * vector<double> rozwiazanie = rozwiazUklad(macierzSchodkowa);
      */
     vector<double> rozwiazUklad(const vector<vector<double>>& macierzSchodkowa);
+
+    /**
+     * @brief Podstawianie wsteczne dla macierzy schodkowej w ciągłym buforze
+     */
+    vector<double> rozwiazUklad(const Macierz& macierzSchodkowa);
+
     /**
  * @brief Przeprowadza rozkład LU z pivotingiem
  * @param A Macierz współczynników
@@ -144,6 +587,9 @@ namespace biblioteka_numeryczna {
  * @param U Macierz górna trójkątna (zostanie wypełniona)
  * @param P Wektor permutacji (zostanie wypełniony)
  *
+ * Zamiany wierszy oraz L i U po każdym kroku są zgłaszane do aktywnego odbiorcy
+ * śledzenia (sledzenie.h); domyślnie nic nie jest wypisywane.
+ *
  * Przykład użycia:
  * vector<vector<double>> A = {{2, 1}, {1, 3}};
  * vector<vector<double>> L, U;
@@ -155,6 +601,127 @@ namespace biblioteka_numeryczna {
                            vector<vector<double>>& U,
                            vector<int>& P);
 
+/**
+ * @brief Rozkład LU z pivotingiem dla macierzy w ciągłym buforze
+ *
+ * Przykład użycia:
+ * Macierz A = {{2, 1}, {1, 3}};
+ * Macierz L, U;
+ * vector<int> P;
+ * rozkladLU_zPivotingiem(A, L, U, P);
+ */
+    void rozkladLU_zPivotingiem(const Macierz& A,
+                           Macierz& L,
+                           Macierz& U,
+                           vector<int>& P);
+
+/**
+ * @brief Blokowy rozkład LU z pivotingiem częściowym (panel + aktualizacja reszty macierzy blokami)
+ * @param A Macierz współczynników n x n
+ * @param L Macierz dolna trójkątna z jedynkami na przekątnej (zostanie wypełniona)
+ * @param U Macierz górna trójkątna (zostanie wypełniona)
+ * @param P Wektor permutacji (zostanie wypełniony)
+ * @param rozmiarBloku Szerokość panelu i kafelka aktualizacji; dobierana tak, by kafelek mieścił się w cache
+ *
+ * Daje te same L, U i P co rozkladLU_zPivotingiem, ale aktualizacja reszty macierzy
+ * odbywa się kafelkami, więc dla dużych n nie jest ograniczona przepustowością pamięci.
+ * Nie wypisuje niczego; dla macierzy osobliwej rzuca runtime_error.
+ *
+ * Przykład użycia:
+ * Macierz A = {{2, 1}, {1, 3}};
+ * Macierz L, U;
+ * vector<int> P;
+ * rozkladLU_blokowy(A, L, U, P, 64);
+ */
+    void rozkladLU_blokowy(const Macierz& A,
+                          Macierz& L,
+                          Macierz& U,
+                          vector<int>& P,
+                          int rozmiarBloku = 64);
+
+    void rozkladLU_blokowy(const vector<vector<double>>& A,
+                          vector<vector<double>>& L,
+                          vector<vector<double>>& U,
+                          vector<int>& P,
+                          int rozmiarBloku = 64);
+
+/**
+ * @brief Rozkład LU z pivotingiem w miejscu - A jest nadpisywana spakowanymi czynnikami
+ * @param A Macierz n x n; po wywołaniu zawiera U na i nad przekątną oraz L pod przekątną
+ *          (jedynki z przekątnej L nie są zapisywane)
+ * @param zamiany Wektor zamian (zostanie wypełniony): w kroku k wiersz k zamieniono z wierszem zamiany[k]
+ * @param rozmiarBloku Szerokość panelu i kafelka aktualizacji (jak w rozkladLU_blokowy)
+ *
+ * Poza A potrzebuje tylko n liczb całkowitych, podczas gdy rozkladLU_zPivotingiem
+ * tworzy dodatkowo pełne macierze L i U (trzy razy tyle pamięci). Czynniki są takie same
+ * jak z rozkladLU_blokowy. Dla macierzy osobliwej rzuca runtime_error; A jest wtedy
+ * częściowo nadpisana.
+ *
+ * Przykład użycia:
+ * Macierz A = {{2, 1}, {1, 3}};
+ * vector<int> zamiany;
+ * rozkladLU_wMiejscu(A, zamiany);
+ * vector<double> b = {3, 4};
+ * rozwiazLU_wMiejscu(A, zamiany, b);   // b = {1, 1}
+ */
+    void rozkladLU_wMiejscu(Macierz& A, vector<int>& zamiany, int rozmiarBloku = 64);
+
+/**
+ * @brief Rozwiązuje Ax = b na podstawie spakowanego rozkładu z rozkladLU_wMiejscu
+ * @param LU Spakowane czynniki
+ * @param zamiany Zamiany wierszy z rozkładu
+ * @param b Wektor wyrazów wolnych, po wywołaniu zawiera x
+ *
+ * Same podstawienia trójkątne na formie spakowanej to podstawianieWPrzod(LU, b, true)
+ * i podstawianieWstecz(LU, b) z jadra_simd.h.
+ */
+    void rozwiazLU_wMiejscu(const Macierz& LU, const vector<int>& zamiany, vector<double>& b);
+
+/**
+ * @brief Rozwiązuje AX = B dla wielu prawych stron (kolumny B), nadpisując B rozwiązaniem
+ */
+    void rozwiazLU_wMiejscu(const Macierz& LU, const vector<int>& zamiany, Macierz& B);
+
+/**
+ * @brief Wielowątkowy kafelkowy rozkład LU z pivotingiem częściowym
+ * @param A Macierz współczynników n x n
+ * @param L Macierz dolna trójkątna z jedynkami na przekątnej (zostanie wypełniona)
+ * @param U Macierz górna trójkątna (zostanie wypełniona)
+ * @param P Wektor permutacji (zostanie wypełniony)
+ * @param liczbaWatkow Liczba wątków (0 - tyle, ile rdzeni)
+ * @param rozmiarKafelka Rozmiar kwadratowego kafelka
+ *
+ * Rozkład panelu, rozwiązania trójkątne i aktualizacje kafelków reszty macierzy są
+ * zadaniami w grafie zależności (GrafZadan), wykonywanymi na puli wątków z kradzieżą
+ * zadań - aktualizacje z kroku k mogą się nakładać z rozkładem panelu w kroku k+1.
+ * Wynik jest taki sam jak z rozkladLU_blokowy. Dla macierzy osobliwej rzuca runtime_error.
+ *
+ * Przykład użycia:
+ * Macierz L, U;
+ * vector<int> P;
+ * rozkladLU_rownolegly(A, L, U, P, 32, 128);
+ */
+    void rozkladLU_rownolegly(const Macierz& A,
+                             Macierz& L,
+                             Macierz& U,
+                             vector<int>& P,
+                             int liczbaWatkow = 0,
+                             int rozmiarKafelka = 128);
+
+/**
+ * @brief Wielowątkowy kafelkowy rozkład LU na istniejącej puli wątków
+ *
+ * Przykład użycia:
+ * PulaWatkow pula(16);
+ * rozkladLU_rownolegly(A, L, U, P, pula, 128);
+ */
+    void rozkladLU_rownolegly(const Macierz& A,
+                             Macierz& L,
+                             Macierz& U,
+                             vector<int>& P,
+                             PulaWatkow& pula,
+                             int rozmiarKafelka = 128);
+
 /**
  * @brief Permutuje wektor zgodnie z wektorem permutacji
  * @param b Wektor do permutacji
@@ -170,14 +737,18 @@ namespace biblioteka_numeryczna {
  * @return Wektor rozwiązań y
  */
     vector<double> rozwiazLy_b(const vector<vector<double>>& L, const vector<double>& b);
+    vector<double> rozwiazLy_b(const Macierz& L, const vector<double>& b);
 
 /**
  * @brief Rozwiązuje układ Ux = y (podstawianie wsteczne)
  * @param U Macierz górna trójkątna
  * @param y Wektor wyrazów wolnych
  * @return Wektor rozwiązań x
+ *
+ * Dla elementu przekątnej o module mniejszym niż 1e-10 rzuca runtime_error.
  */
     vector<double> rozwiazUx_y(const vector<vector<double>>& U, const vector<double>& y);
+    vector<double> rozwiazUx_y(const Macierz& U, const vector<double>& y);
 
 /**
  * @brief Sprawdza poprawność rozwiązania i zwraca maksymalny błąd
@@ -189,15 +760,385 @@ namespace biblioteka_numeryczna {
     double sprawdzPoprawnosc(const vector<vector<double>>& A,
                         const vector<double>& x,
                         const vector<double>& b);
+    double sprawdzPoprawnosc(const Macierz& A,
+                        const vector<double>& x,
+                        const vector<double>& b);
 
 /**
  * @brief Rozwiązuje układ równań metodą rozkładu LU z pivotingiem
  * @param A Macierz współczynników
  * @param b Wektor wyrazów wolnych
  * @return Para (y, x) gdzie y to rozwiązanie Ly=Pb, x to końcowe rozwiązanie
+ *
+ * Gdy włączona jest pamięć rozkładów (ustawPamiecRozkladow), rozkład tej samej macierzy
+ * jest brany z pamięci zamiast liczony od nowa.
  */
     pair<vector<double>, vector<double>> rozwiazUkladLU(const vector<vector<double>>& A,
                                                    const vector<double>& b);
+    pair<vector<double>, vector<double>> rozwiazUkladLU(const Macierz& A,
+                                                   const vector<double>& b);
+
+    /**
+     * @brief Wynik rozwiązania w mieszanej precyzji
+     */
+    struct WynikMieszanejPrecyzji {
+        vector<double> x;                       // rozwiązanie
+        int krokiPoprawek = 0;                  // liczba kroków poprawiania (residuum w double)
+        bool uzytoPodwojnejPrecyzji = false;    // czy nastąpił powrót do rozkładu w double
+        double residuumWzgledne = 0.0;          // ||b - Ax||_inf / (||A||_inf ||x||_inf)
+    };
+
+    /**
+     * @brief Rozwiązuje układ rozkładem LU w float i poprawia wynik iteracyjnie residuami liczonymi w double
+     * @param A Macierz współczynników n x n
+     * @param b Wektor wyrazów wolnych
+     * @param maxKrokow Maksymalna liczba kroków poprawiania
+     * @return Rozwiązanie z liczbą kroków i informacją o powrocie do double
+     *
+     * Rozkład w float zajmuje połowę pamięci i mieści dwa razy więcej elementów w rejestrze
+     * wektorowym; dla macierzy dobrze uwarunkowanych kilka kroków x += A_f^-1 (b - A x)
+     * przywraca dokładność double (jak LAPACK dsgesv). Gdy poprawki przestają zmniejszać
+     * residuum, nie osiągają dokładności w maxKrokow krokach, albo rozkład w float się nie
+     * udaje (elementy poza zakresem float, zerowy element główny), układ jest rozwiązywany
+     * zwykłym rozkładem LU w double.
+     *
+     * Przykład użycia:
+     * WynikMieszanejPrecyzji wynik = rozwiazUkladLU_mieszanaPrecyzja(A, b);
+     * if (wynik.uzytoPodwojnejPrecyzji) { ... }   // macierz źle uwarunkowana dla float
+     */
+    WynikMieszanejPrecyzji rozwiazUkladLU_mieszanaPrecyzja(const Macierz& A,
+                                                            const vector<double>& b,
+                                                            int maxKrokow = 30);
+    WynikMieszanejPrecyzji rozwiazUkladLU_mieszanaPrecyzja(const vector<vector<double>>& A,
+                                                            const vector<double>& b,
+                                                            int maxKrokow = 30);
+
+/**
+ * @brief Rozkład LU z pivotingiem wyliczany raz i używany do rozwiązywania wielu układów z tą samą macierzą
+ *
+ * Przechowuje spakowane czynniki (U na i nad przekątną, L bez jedynek pod przekątną)
+ * oraz permutację wierszy. Rozkład kosztuje O(n^3) jednorazowo, każda kolejna prawa
+ * strona już tylko O(n^2).
+ *
+ * Przykład użycia:
+ * Macierz A = {{2, 1}, {1, 3}};
+ * RozkladLU lu(A);
+ * vector<double> x1 = lu.solve({3, 4});
+ * vector<double> x2 = lu.solve({1, 0});
+ */
+    class RozkladLU {
+    public:
+        explicit RozkladLU(const Macierz& A, int rozmiarBloku = 64);
+        explicit RozkladLU(const vector<vector<double>>& A, int rozmiarBloku = 64);
+
+        /**
+         * @brief Rozwiązuje Ax = b
+         * @param b Wektor wyrazów wolnych
+         * @return Wektor rozwiązań x
+         */
+        vector<double> solve(const vector<double>& b) const;
+
+        /**
+         * @brief Rozwiązuje Ax = b nadpisując b rozwiązaniem (bez dodatkowej alokacji)
+         * @param b Wektor wyrazów wolnych, po wywołaniu zawiera x
+         */
+        void solve_in_place(vector<double>& b) const;
+
+        /**
+         * @brief Rozwiązuje AX = B dla wielu prawych stron naraz
+         * @param B Macierz n x m, każda kolumna to osobna prawa strona
+         * @return Macierz X n x m z rozwiązaniami w kolumnach
+         */
+        Macierz solve_many(const Macierz& B) const;
+
+        /**
+         * @brief Rozwiązuje układ dla każdego wektora z listy prawych stron
+         * @param B Lista wektorów wyrazów wolnych
+         * @return Lista rozwiązań w tej samej kolejności
+         */
+        vector<vector<double>> solve_many(const vector<vector<double>>& B) const;
+
+        /**
+         * @brief Rozwiązuje A^T x = b (U^T L^T P x = b) na tym samym rozkładzie
+         * @param b Wektor wyrazów wolnych
+         * @return Wektor rozwiązań x
+         */
+        vector<double> solve_transposed(const vector<double>& b) const;
+        void solve_transposed_in_place(vector<double>& b) const;
+
+        /**
+         * @brief Oszacowanie ||A^{-1}||_1 metodą Hagera-Highama w O(n^2)
+         *
+         * Kilka (zwykle 2-3, najwyżej 5) par rozwiązań z A i A^T zamiast liczenia odwrotności.
+         * Oszacowanie nie przekracza prawdziwej normy i w praktyce rzadko jest od niej mniejsze
+         * więcej niż kilka razy (jak LAPACK dlacn2).
+         */
+        double oszacujNormeOdwrotnosci() const;
+
+        int rozmiar() const { return LU_.wiersze(); }
+        const Macierz& macierzLU() const { return LU_; }
+        const vector<int>& permutacja() const { return P_; }
+
+    private:
+        Macierz LU_;
+        vector<int> P_;
+        vector<int> zamiany_;   // P_ zapisane jako ciąg transpozycji, do permutowania w miejscu
+    };
+
+    /**
+     * @brief Oszacowanie wskaźnika uwarunkowania kappa_1(A) = ||A||_1 ||A^{-1}||_1 na gotowym rozkładzie
+     * @param A Macierz, której rozkładem jest lu
+     * @param lu Rozkład A
+     * @return Oszacowanie kappa_1(A) (od dołu), koszt O(n^2)
+     *
+     * Przykład użycia:
+     * RozkladLU lu(A);
+     * if (oszacujUwarunkowanie(A, lu) > 1e12) {
+     *     cerr << "Macierz źle uwarunkowana" << endl;
+     * }
+     */
+    double oszacujUwarunkowanie(const Macierz& A, const RozkladLU& lu);
+
+    /**
+     * @brief Współczynnik wzrostu rozkładu: max |u_ij| / max |a_ij|
+     *
+     * Duża wartość (rzędu 2^n w najgorszym przypadku pivotingu częściowego) oznacza,
+     * że błąd zaokrągleń rozkładu mógł być znacznie większy niż eps * ||A||.
+     */
+    double wspolczynnikWzrostu(const Macierz& A, const RozkladLU& lu);
+
+    /**
+     * @brief Wynik rozwiązania układu z informacją o jego jakości
+     */
+    struct RaportRozwiazaniaLU {
+        vector<double> y;                   // rozwiązanie Ly = Pb
+        vector<double> x;                   // rozwiązanie Ax = b
+        double uwarunkowanie = 0.0;         // oszacowanie kappa_1(A)
+        double wspolczynnikWzrostu = 0.0;   // max |u_ij| / max |a_ij|
+    };
+
+/**
+ * @brief Rozwiązuje układ jak rozwiazUkladLU i dołącza oszacowanie uwarunkowania oraz współczynnik wzrostu
+ * @param A Macierz współczynników
+ * @param b Wektor wyrazów wolnych
+ * @return Rozwiązanie (y, x) z oszacowaniem kappa_1(A) i współczynnikiem wzrostu
+ *
+ * Dodatkowy koszt to O(n^2), bez tworzenia odwrotności. Korzysta z pamięci rozkładów, gdy jest włączona.
+ * Względny błąd x można szacować jako uwarunkowanie * wspolczynnikWzrostu * 1e-16.
+ *
+ * Przykład użycia:
+ * RaportRozwiazaniaLU raport = rozwiazUkladLU_zRaportem(A, b);
+ * if (raport.uwarunkowanie > 1e10) {
+ *     cerr << "Ostrzeżenie: kappa_1(A) ~ " << raport.uwarunkowanie << endl;
+ * }
+ */
+    RaportRozwiazaniaLU rozwiazUkladLU_zRaportem(const Macierz& A, const vector<double>& b);
+    RaportRozwiazaniaLU rozwiazUkladLU_zRaportem(const vector<vector<double>>& A, const vector<double>& b);
+
+    /**
+     * @brief Wynik rozkładu, który nie rzuca wyjątku przy niepowodzeniu
+     */
+    enum class StatusRozkladu {
+        Poprawny,
+        NieDodatnioOkreslona,   // Cholesky: niedodatni element główny
+        Osobliwa                // LDL^T: zerowa kolumna w trakcie rozkładu
+    };
+
+    /**
+     * @brief Blokowy rozkład Cholesky'ego A = L L^T macierzy symetrycznej dodatnio określonej
+     *
+     * Czytany jest tylko dolny trójkąt A. Czynnik L jest przechowywany w spakowanym dolnym
+     * trójkącie (wiersz i to i + 1 kolejnych liczb), więc zajmuje n (n + 1) / 2 liczb,
+     * a rozkład kosztuje n^3 / 3 działań - połowę tego, co LU. Gdy macierz okazuje się nie być
+     * dodatnio określona, konstruktor nie rzuca wyjątku: status() zwraca NieDodatnioOkreslona,
+     * a kolumnaBledu() wskazuje kolumnę z niedodatnim elementem głównym.
+     *
+     * Przykład użycia (macierz Grama z aproksymacji):
+     * Macierz G(k, k);
+     * for (int i = 0; i < k; i++)
+     *     for (int j = 0; j <= i; j++)
+     *         G(i, j) = iloczynSkalarnyElementowZBazy(i, j, a, b, 1000);
+     * RozkladCholeskyego chol(G);
+     * if (chol.poprawny()) {
+     *     vector<double> wspolczynniki = chol.solve(prawaStrona);
+     * }
+     */
+    class RozkladCholeskyego {
+    public:
+        /**
+         * @param A Macierz symetryczna n x n (używany jest dolny trójkąt)
+         * @param rozmiarBloku Szerokość bloku kolumn w rozkładzie blokowym
+         */
+        explicit RozkladCholeskyego(const Macierz& A, int rozmiarBloku = 64);
+        explicit RozkladCholeskyego(const vector<vector<double>>& A, int rozmiarBloku = 64);
+
+        StatusRozkladu status() const { return status_; }
+        bool poprawny() const { return status_ == StatusRozkladu::Poprawny; }
+        int kolumnaBledu() const { return kolumnaBledu_; }
+
+        /**
+         * @brief Rozwiązuje A x = b; dla nieudanego rozkładu rzuca runtime_error
+         */
+        vector<double> solve(const vector<double>& b) const;
+        void solve_in_place(vector<double>& b) const;
+
+        /**
+         * @brief Rozwiązuje A X = B dla wszystkich kolumn B naraz
+         */
+        Macierz solve_many(const Macierz& B) const;
+        vector<vector<double>> solve_many(const vector<vector<double>>& B) const;
+
+        int rozmiar() const { return n_; }
+
+        /**
+         * @brief Czynnik L jako pełna macierz (do podglądu)
+         */
+        Macierz czynnikL() const;
+
+    private:
+        void rozloz(const Macierz& A, int rozmiarBloku);
+        void sprawdzStatus() const;
+
+        int n_ = 0;
+        vector<double> L_;      // spakowany dolny trójkąt, wierszami
+        StatusRozkladu status_ = StatusRozkladu::Poprawny;
+        int kolumnaBledu_ = -1;
+    };
+
+    /**
+     * @brief Rozkład P A P^T = L D L^T macierzy symetrycznej (także nieokreślonej) z wyborem Bunch-Kaufmana
+     *
+     * L ma jedynki na przekątnej, D jest blokowo diagonalna z blokami 1 x 1 i 2 x 2 (bloki 2 x 2
+     * pozwalają rozłożyć np. macierze z zerami na przekątnej bez utraty stabilności). Czytany
+     * jest tylko dolny trójkąt A; L jest spakowany jak w RozkladCholeskyego. Bezwładność
+     * (liczby dodatnich, ujemnych i zerowych wartości własnych) odczytana z D mówi, czy
+     * macierz jest dodatnio określona. Dla macierzy osobliwej status() zwraca Osobliwa
+     * zamiast rzucać wyjątek.
+     *
+     * Przykład użycia:
+     * Macierz A = {{0, 1}, {1, 0}};
+     * RozkladLDLT ldlt(A);
+     * vector<double> x = ldlt.solve({1, 2});
+     * bool spd = ldlt.dodatnioOkreslona();        // false: wartości własne 1 i -1
+     */
+    class RozkladLDLT {
+    public:
+        struct Bezwladnosc {
+            int dodatnie = 0;
+            int ujemne = 0;
+            int zerowe = 0;
+        };
+
+        explicit RozkladLDLT(const Macierz& A);
+        explicit RozkladLDLT(const vector<vector<double>>& A);
+
+        StatusRozkladu status() const { return status_; }
+        bool poprawny() const { return status_ == StatusRozkladu::Poprawny; }
+        int kolumnaBledu() const { return kolumnaBledu_; }
+
+        Bezwladnosc bezwladnosc() const;
+        bool dodatnioOkreslona() const;
+
+        /**
+         * @brief Rozwiązuje A x = b; dla nieudanego rozkładu rzuca runtime_error
+         */
+        vector<double> solve(const vector<double>& b) const;
+        void solve_in_place(vector<double>& b) const;
+        Macierz solve_many(const Macierz& B) const;
+        vector<vector<double>> solve_many(const vector<vector<double>>& B) const;
+
+        int rozmiar() const { return n_; }
+        const vector<int>& permutacja() const { return P_; }
+        Macierz czynnikL() const;
+        Macierz czynnikD() const;
+
+    private:
+        void rozloz(const Macierz& A);
+        void sprawdzStatus() const;
+        bool poczatekBloku2(int k) const { return k + 1 < n_ && poddiagonalaD_[k] != 0.0; }
+
+        int n_ = 0;
+        vector<double> L_;              // spakowany dolny trójkąt: L pod przekątną, D na przekątnej
+        vector<double> poddiagonalaD_;  // poddiagonalaD_[k] != 0 - blok 2 x 2 w wierszach k, k+1
+        vector<int> P_;
+        StatusRozkladu status_ = StatusRozkladu::Poprawny;
+        int kolumnaBledu_ = -1;
+    };
+
+    /**
+     * @brief Algorytm Thomasa dla układu trójprzekątniowego, O(n) czasu i pamięci
+     * @param pod Przekątna pod główną, pod[i] = a(i+1, i), długość n-1
+     * @param glowna Przekątna główna, długość n
+     * @param nad Przekątna nad główną, nad[i] = a(i, i+1), długość n-1
+     * @param wektor_b Wektor wyrazów wolnych, długość n
+     * @return Wektor rozwiązań
+     *
+     * Eliminacja bez wyboru elementu głównego - stabilna dla macierzy z dominującą przekątną
+     * lub symetrycznych dodatnio określonych (np. splajny, schematy różnicowe). Dla innych
+     * macierzy trójprzekątniowych należy użyć rozkladLU_pasmowy. Przy zerowym elemencie
+     * głównym rzuca runtime_error.
+     *
+     * Przykład użycia:
+     * vector<double> x = metodaThomasa({-1, -1}, {2, 2, 2}, {-1, -1}, {1, 0, 1});
+     */
+    vector<double> metodaThomasa(const vector<double>& pod,
+                                 const vector<double>& glowna,
+                                 const vector<double>& nad,
+                                 const vector<double>& wektor_b);
+
+    /**
+     * @brief Algorytm Thomasa dla wielu niezależnych układów trójprzekątniowych naraz
+     * @param n Wymiar każdego układu
+     * @param liczbaUkladow Liczba układów m
+     * @param pod Przekątne pod główną, element i układu s pod indeksem i * m + s ((n-1) * m elementów)
+     * @param glowna Przekątne główne, element i układu s pod indeksem i * m + s (n * m elementów)
+     * @param nad Przekątne nad główną, układ jak w pod ((n-1) * m elementów)
+     * @param wektory_b Prawe strony (n * m elementów), nadpisywane rozwiązaniami
+     * @return Liczba układów z zerowym elementem głównym; ich rozwiązania to NaN
+     *
+     * Dane są przeplecione (struktura tablic): kolejne układy leżą obok siebie, więc każdy
+     * krok algorytmu jest pętlą o stałym kroku po układach, wektoryzowaną przez kompilator.
+     * Układy są przetwarzane grupami, aby bufor pomocniczy mieścił się w cache.
+     * Zerowy element główny w jednym układzie nie przerywa obliczeń (jak w rozwiazUkladyWsadowo):
+     * pozostałe układy są rozwiązywane, a nieudane można rozpoznać po isnan.
+     *
+     * Przykład użycia:
+     * vector<double> pod((n - 1) * m, -1.0), glowna(n * m, 2.0), nad((n - 1) * m, -1.0);
+     * vector<double> b(n * m, 1.0);
+     * int osobliwe = metodaThomasaWsadowa(n, m, pod.data(), glowna.data(), nad.data(), b.data());
+     */
+    int metodaThomasaWsadowa(int n, int liczbaUkladow,
+                              const double* pod, const double* glowna, const double* nad,
+                              double* wektory_b);
+
+    /**
+     * @brief Rozkład LU macierzy pasmowej z częściowym wyborem elementu głównego, w miejscu
+     * @param A Macierz pasmowa; po rozkładzie zawiera U (o szerokości gorna + dolna nad przekątną)
+     *          oraz mnożniki L pod przekątną
+     * @param zamiany Wektor zamian wierszy (zostanie wypełniony): w kroku k wiersz k zamieniono z zamiany[k]
+     *
+     * Odpowiednik LAPACK gbtrf: koszt O(n * dolna * (dolna + gorna)) zamiast O(n^3).
+     * Dla macierzy osobliwej rzuca runtime_error.
+     *
+     * Przykład użycia:
+     * vector<int> zamiany;
+     * rozkladLU_pasmowy(A, zamiany);
+     * rozwiazLU_pasmowy(A, zamiany, b);      // b zawiera teraz rozwiązanie
+     */
+    void rozkladLU_pasmowy(MacierzPasmowa& A, vector<int>& zamiany);
+
+    /**
+     * @brief Rozwiązuje układ z rozkładu rozkladLU_pasmowy; b jest nadpisywany rozwiązaniem
+     */
+    void rozwiazLU_pasmowy(const MacierzPasmowa& LU, const vector<int>& zamiany, vector<double>& wektor_b);
+
+    /**
+     * @brief Rozwiązuje układ z macierzą pasmową (rozkład na kopii macierzy)
+     *
+     * Przykład użycia:
+     * vector<double> x = rozwiazUkladPasmowy(A, b);
+     */
+    vector<double> rozwiazUkladPasmowy(const MacierzPasmowa& A, const vector<double>& wektor_b);
 
 /**
  * @brief Testuje rozwiązanie układu równań z pliku
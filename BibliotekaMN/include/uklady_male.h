@@ -0,0 +1,173 @@
+//
+// Created by Szymon Ros on 17/10/2026.
+//
+
+#ifndef UKLADY_MALE_H
+#define UKLADY_MALE_H
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+using namespace std;
+
+namespace biblioteka_numeryczna {
+    /**
+     * @brief Rozwiązuje układ N x N o rozmiarze znanym w czasie kompilacji (eliminacja Gaussa z pivotingiem)
+     * @param A Macierz współczynników (kopiowana - na stosie, bez alokacji)
+     * @param b Wektor wyrazów wolnych
+     * @return Wektor rozwiązań x
+     *
+     * Wszystkie pętle mają stałą liczbę obrotów, więc kompilator rozwija je w całości.
+     * Dla elementu głównego o module mniejszym niż 1e-10 rzuca runtime_error, jak eliminacjaGaussa.
+     *
+     * Przykład użycia:
+     * array<array<double, 3>, 3> A = {{{4, 1, 0}, {1, 4, 1}, {0, 1, 4}}};
+     * array<double, 3> x = rozwiazUkladStaly<3>(A, {5, 6, 5});   // {1, 1, 1}
+     */
+    template <int N>
+    array<double, N> rozwiazUkladStaly(array<array<double, N>, N> A, array<double, N> b) {
+        static_assert(N > 0, "Rozmiar układu musi być dodatni");
+        for (int k = 0; k < N; k++) {
+            int p = k;
+            for (int i = k + 1; i < N; i++) {
+                if (fabs(A[i][k]) > fabs(A[p][k])) p = i;
+            }
+            if (fabs(A[p][k]) < 1e-10) {
+                throw runtime_error("Macierz jest osobliwa");
+            }
+            swap(A[k], A[p]);
+            swap(b[k], b[p]);
+
+            double odwrotnosc = 1.0 / A[k][k];
+            for (int i = k + 1; i < N; i++) {
+                double l = A[i][k] * odwrotnosc;
+                for (int j = k + 1; j < N; j++) {
+                    A[i][j] -= l * A[k][j];
+                }
+                b[i] -= l * b[k];
+            }
+        }
+        for (int i = N - 1; i >= 0; i--) {
+            double suma = b[i];
+            for (int j = i + 1; j < N; j++) {
+                suma -= A[i][j] * b[j];
+            }
+            b[i] = suma / A[i][i];
+        }
+        return b;
+    }
+
+    /**
+     * @brief Rozwiązuje wiele niezależnych układów N x N zapisanych jako struktura tablic
+     * @param liczbaUkladow Liczba układów m
+     * @param A Macierze: element (i, j) układu s pod indeksem (i * N + j) * m + s; niszczone
+     * @param b Prawe strony: element i układu s pod indeksem i * m + s; nadpisywane rozwiązaniami
+     * @return Liczba układów osobliwych (element główny o module < 1e-10); ich rozwiązania to NaN
+     *
+     * Układ danych jak w metodaThomasaWsadowa: sąsiednie układy leżą obok siebie, więc każda
+     * operacja eliminacji jest pętlą po układach, w której każda linia SIMD rozwiązuje inny układ.
+     * Wybór elementu głównego nie rozgałęzia się: wiersz k jest porównywany z każdym wierszem
+     * i > k i zamieniany z nim przez wybór (select) tam, gdzie |a_ik| > |a_kk|, więc po przejściu
+     * w wierszu k każdego układu stoi element o największym module w kolumnie. Układy są
+     * przetwarzane grupami po 64, żeby dane grupy pozostawały w cache L1/L2.
+     *
+     * Przykład użycia:
+     * vector<double> A(9 * m), b(3 * m);      // m układów 3 x 3
+     * int osobliwe = rozwiazUkladyWsadowo<3>(m, A.data(), b.data());
+     */
+    template <int N>
+    int rozwiazUkladyWsadowo(int liczbaUkladow, double* A, double* b) {
+        static_assert(N > 0, "Rozmiar układu musi być dodatni");
+        const int GRUPA = 64;
+        const size_t m = liczbaUkladow;
+        auto a = [&](int i, int j) { return A + static_cast<size_t>(i * N + j) * m; };
+        auto w = [&](int i) { return b + static_cast<size_t>(i) * m; };
+
+        int osobliwe = 0;
+        for (size_t s0 = 0; s0 < m; s0 += GRUPA) {
+            int g = static_cast<int>(min<size_t>(GRUPA, m - s0));
+            bool poprawny[GRUPA];
+            double odwrotnosc[N][GRUPA];
+            for (int s = 0; s < g; s++) {
+                poprawny[s] = true;
+            }
+
+            for (int k = 0; k < N; k++) {
+                const double* a_kk = a(k, k) + s0;
+                for (int i = k + 1; i < N; i++) {
+                    bool zamien[GRUPA];
+                    const double* a_ik = a(i, k) + s0;
+                    for (int s = 0; s < g; s++) {
+                        zamien[s] = fabs(a_ik[s]) > fabs(a_kk[s]);
+                    }
+                    for (int j = k; j <= N; j++) {
+                        double* x = (j < N ? a(k, j) : w(k)) + s0;
+                        double* y = (j < N ? a(i, j) : w(i)) + s0;
+                        for (int s = 0; s < g; s++) {
+                            double xs = x[s], ys = y[s];
+                            x[s] = zamien[s] ? ys : xs;
+                            y[s] = zamien[s] ? xs : ys;
+                        }
+                    }
+                }
+
+                for (int s = 0; s < g; s++) {
+                    poprawny[s] = poprawny[s] && fabs(a_kk[s]) >= 1e-10;
+                    odwrotnosc[k][s] = 1.0 / a_kk[s];
+                }
+                for (int i = k + 1; i < N; i++) {
+                    double l[GRUPA];
+                    const double* a_ik = a(i, k) + s0;
+                    for (int s = 0; s < g; s++) {
+                        l[s] = a_ik[s] * odwrotnosc[k][s];
+                    }
+                    for (int j = k + 1; j <= N; j++) {
+                        const double* x = (j < N ? a(k, j) : w(k)) + s0;
+                        double* y = (j < N ? a(i, j) : w(i)) + s0;
+                        for (int s = 0; s < g; s++) {
+                            y[s] -= l[s] * x[s];
+                        }
+                    }
+                }
+            }
+
+            for (int i = N - 1; i >= 0; i--) {
+                double* b_i = w(i) + s0;
+                for (int j = i + 1; j < N; j++) {
+                    const double* a_ij = a(i, j) + s0;
+                    const double* b_j = w(j) + s0;
+                    for (int s = 0; s < g; s++) {
+                        b_i[s] -= a_ij[s] * b_j[s];
+                    }
+                }
+                for (int s = 0; s < g; s++) {
+                    b_i[s] *= odwrotnosc[i][s];
+                }
+            }
+
+            for (int s = 0; s < g; s++) {
+                if (!poprawny[s]) {
+                    osobliwe++;
+                    for (int i = 0; i < N; i++) {
+                        w(i)[s0 + s] = numeric_limits<double>::quiet_NaN();
+                    }
+                }
+            }
+        }
+        return osobliwe;
+    }
+
+    /**
+     * @brief Wersja z rozmiarem podawanym w czasie wykonania; wybiera rozwiazUkladyWsadowo<n> dla n = 1..16
+     *
+     * Dla innych n rzuca invalid_argument.
+     *
+     * Przykład użycia:
+     * int osobliwe = rozwiazUkladyWsadowo(n, m, A.data(), b.data());
+     */
+    int rozwiazUkladyWsadowo(int n, int liczbaUkladow, double* A, double* b);
+}
+
+#endif // UKLADY_MALE_H
@@ -27,8 +27,58 @@ int main() {
        testEliminacjaGaussa2();
        testMetodaGaussaSeidela1();
        testMetodaGaussaSeidela2();
+       testMetodaGaussaSeidela3();
+       testMetodaGaussaSeidela4();
        testRozkladLU1();
        testRozkladLU2();
+       testRozkladLUBlokowy1();
+       testRozkladLUBlokowy2();
+       testRozkladLURownolegly1();
+       testRozkladLURownolegly2();
+       testJadraSimd1();
+       testJadraSimd2();
+       testRozkladLUObiekt1();
+       testRozkladLUObiekt2();
+       testSledzenie1();
+       testSledzenie2();
+       testMacierz1();
+       testMacierz2();
+       testMacierzRzadka1();
+       testMacierzRzadka2();
+       testGradientySprzezone1();
+       testGradientySprzezone2();
+       testKrylow1();
+       testKrylow2();
+       testSORAdaptacyjna1();
+       testSORAdaptacyjna2();
+       testGaussSeidelKolorowy1();
+       testGaussSeidelKolorowy2();
+       testUkladyPasmowe1();
+       testUkladyPasmowe2();
+       testRozkladCholeskyego1();
+       testRozkladCholeskyego2();
+       testMieszanaPrecyzja1();
+       testMieszanaPrecyzja2();
+       testWczytywanie1();
+       testWczytywanie2();
+       testFormatBinarny1();
+       testFormatBinarny2();
+       testMatrixMarket1();
+       testMatrixMarket2();
+       testLUPozaPamiecia1();
+       testLUPozaPamiecia2();
+       testRozkladLUWMiejscu1();
+       testRozkladLUWMiejscu2();
+       testUkladyMale1();
+       testUkladyMale2();
+       testPamiecRozkladow1();
+       testPamiecRozkladow2();
+       testAktualizacjeLU1();
+       testAktualizacjeLU2();
+       testUwarunkowanie1();
+       testUwarunkowanie2();
+       testRozkladyRzadkie1();
+       testRozkladyRzadkie2();
 
        // Testy interpolacji
        testInterpolacjaLagrangea1();
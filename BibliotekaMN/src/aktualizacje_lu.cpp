@@ -0,0 +1,264 @@
+//
+// Created by Szymon Ros on 17/10/2026.
+//
+#include "../include/aktualizacje_lu.h"
+#include "../include/jadra_simd.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+using namespace std;
+
+namespace biblioteka_numeryczna {
+    // Z = A^{-1} U, po sprawdzeniu wymiarow
+    static Macierz rozwiazDlaPoprawki(const shared_ptr<const RozkladLU>& baza, const Macierz& U, const Macierz& V) {
+        if (!baza) {
+            throw invalid_argument("Brak rozkładu bazowego");
+        }
+        int n = baza->rozmiar();
+        if (U.wiersze() != n || V.wiersze() != n || U.kolumny() != V.kolumny() || U.kolumny() == 0) {
+            throw invalid_argument("Nieprawidłowe wymiary macierzy poprawki");
+        }
+        return baza->solve_many(U);
+    }
+
+    // I + V^T Z
+    static Macierz macierzPojemnosci(const Macierz& VT, const Macierz& Z) {
+        int k = VT.wiersze();
+        int n = VT.kolumny();
+        Macierz C = Macierz::jednostkowa(k);
+        for (int i = 0; i < k; i++) {
+            const double* v = VT.wiersz(i);
+            for (int l = 0; l < n; l++) {
+                const double* z = Z.wiersz(l);
+                for (int j = 0; j < k; j++) {
+                    C(i, j) += v[l] * z[j];
+                }
+            }
+        }
+        return C;
+    }
+
+    static Macierz transponuj(const Macierz& M) {
+        Macierz T(M.kolumny(), M.wiersze());
+        for (int i = 0; i < M.wiersze(); i++) {
+            for (int j = 0; j < M.kolumny(); j++) {
+                T(j, i) = M(i, j);
+            }
+        }
+        return T;
+    }
+
+    RozkladLUZPoprawka::RozkladLUZPoprawka(shared_ptr<const RozkladLU> baza, const Macierz& U, const Macierz& V)
+        : baza_(move(baza)),
+          Z_(rozwiazDlaPoprawki(baza_, U, V)),
+          VT_(transponuj(V)),
+          pojemnosc_(macierzPojemnosci(VT_, Z_)) {}
+
+    RozkladLUZPoprawka RozkladLUZPoprawka::zmianaWiersza(shared_ptr<const RozkladLU> baza, int i,
+                                                         const vector<double>& roznica) {
+        int n = baza ? baza->rozmiar() : 0;
+        if (i < 0 || i >= n || roznica.size() != n) {
+            throw invalid_argument("Nieprawidłowy numer wiersza lub długość wektora");
+        }
+        Macierz U(n, 1), V(n, 1);
+        U(i, 0) = 1.0;
+        for (int j = 0; j < n; j++) {
+            V(j, 0) = roznica[j];
+        }
+        return RozkladLUZPoprawka(move(baza), U, V);
+    }
+
+    RozkladLUZPoprawka RozkladLUZPoprawka::zmianaKolumny(shared_ptr<const RozkladLU> baza, int j,
+                                                         const vector<double>& roznica) {
+        int n = baza ? baza->rozmiar() : 0;
+        if (j < 0 || j >= n || roznica.size() != n) {
+            throw invalid_argument("Nieprawidłowy numer kolumny lub długość wektora");
+        }
+        Macierz U(n, 1), V(n, 1);
+        V(j, 0) = 1.0;
+        for (int i = 0; i < n; i++) {
+            U(i, 0) = roznica[i];
+        }
+        return RozkladLUZPoprawka(move(baza), U, V);
+    }
+
+    vector<double> RozkladLUZPoprawka::solve(const vector<double>& b) const {
+        int n = rozmiar();
+        int k = rzadPoprawki();
+        if (b.size() != n) {
+            throw invalid_argument("Nieprawidłowe wymiary macierzy lub wektora");
+        }
+
+        vector<double> y = baza_->solve(b);
+        vector<double> t(k, 0.0);
+        for (int i = 0; i < k; i++) {
+            const double* v = VT_.wiersz(i);
+            double suma = 0.0;
+            for (int l = 0; l < n; l++) {
+                suma += v[l] * y[l];
+            }
+            t[i] = suma;
+        }
+        pojemnosc_.solve_in_place(t);
+        for (int l = 0; l < n; l++) {
+            const double* z = Z_.wiersz(l);
+            double suma = 0.0;
+            for (int i = 0; i < k; i++) {
+                suma += z[i] * t[i];
+            }
+            y[l] -= suma;
+        }
+        return y;
+    }
+
+    RozkladLUAktualizowany::RozkladLUAktualizowany(const Macierz& A, int maksymalnaLiczbaAktualizacji,
+                                                   double progStabilnosci)
+        : A_(A), maksymalnaLiczbaAktualizacji_(maksymalnaLiczbaAktualizacji), progStabilnosci_(progStabilnosci) {
+        if (A.kolumny() != A.wiersze()) {
+            throw invalid_argument("Macierz musi być kwadratowa");
+        }
+        if (maksymalnaLiczbaAktualizacji < 0 || progStabilnosci < 0.0) {
+            throw invalid_argument("Nieprawidłowe parametry aktualizacji");
+        }
+        rozloz();
+    }
+
+    void RozkladLUAktualizowany::rozloz() {
+        int n = A_.wiersze();
+        Macierz LU = A_;
+        vector<int> zamiany;
+        rozkladLU_wMiejscu(LU, zamiany);
+
+        // dopiero po udanym rozkladzie - przy wyjatku stan pozostaje bez zmian
+        LU_ = move(LU);
+        zamiany_ = move(zamiany);
+        U_ = Macierz(n, n);
+        for (int i = 0; i < n; i++) {
+            const double* lu = LU_.wiersz(i);
+            double* u = U_.wiersz(i);
+            for (int j = i; j < n; j++) {
+                u[j] = lu[j];
+            }
+        }
+        kolejnosc_.resize(n);
+        pozycja_.resize(n);
+        for (int i = 0; i < n; i++) {
+            kolejnosc_[i] = i;
+            pozycja_[i] = i;
+        }
+        przeksztalcenia_.clear();
+        liczbaRozkladow_++;
+    }
+
+    void RozkladLUAktualizowany::przeksztalc(vector<double>& b) const {
+        int n = rozmiar();
+        for (int i = 0; i < n; i++) {
+            swap(b[i], b[zamiany_[i]]);
+        }
+        podstawianieWPrzod(LU_, b.data(), true);
+        for (const Przeksztalcenie& e : przeksztalcenia_) {
+            double suma = 0.0;
+            for (size_t t = 0; t < e.kolumny.size(); t++) {
+                suma += e.mnozniki[t] * b[e.kolumny[t]];
+            }
+            b[e.wiersz] -= suma;
+        }
+    }
+
+    void RozkladLUAktualizowany::zamienKolumne(int j, const vector<double>& kolumna) {
+        int n = rozmiar();
+        if (j < 0 || j >= n || kolumna.size() != n) {
+            throw invalid_argument("Nieprawidłowy numer kolumny lub długość wektora");
+        }
+
+        // kolec: nowa kolumna po przeksztalceniu P, L^{-1} i dotychczasowych E
+        vector<double> kolec = kolumna;
+        przeksztalc(kolec);
+
+        // wiersz j (pozycja p) zerowany na pozycjach p+1..n-1 wierszami, ktore tam maja elementy glowne;
+        // wiersz c ma w kolumnie j (przesuwanej na koniec) wartosc kolec[c]
+        int p = pozycja_[j];
+        vector<double> w(n, 0.0);
+        const double* wiersz_j = U_.wiersz(j);
+        for (int r = p + 1; r < n; r++) {
+            w[kolejnosc_[r]] = wiersz_j[kolejnosc_[r]];
+        }
+        double przekatna = kolec[j];
+        Przeksztalcenie e{j, {}, {}};
+        for (int r = p + 1; r < n; r++) {
+            int c = kolejnosc_[r];
+            if (w[c] == 0.0) {
+                continue;
+            }
+            const double* wiersz_c = U_.wiersz(c);
+            double l = w[c] / wiersz_c[c];
+            for (int s = r + 1; s < n; s++) {
+                w[kolejnosc_[s]] -= l * wiersz_c[kolejnosc_[s]];
+            }
+            przekatna -= l * kolec[c];
+            e.kolumny.push_back(c);
+            e.mnozniki.push_back(l);
+        }
+
+        double maxKolca = 0.0;
+        for (double v : kolec) {
+            maxKolca = max(maxKolca, fabs(v));
+        }
+        bool niestabilna = fabs(przekatna) < 1e-10 || fabs(przekatna) < progStabilnosci_ * maxKolca;
+        if (niestabilna || liczbaAktualizacji() >= maksymalnaLiczbaAktualizacji_) {
+            vector<double> stara(n);
+            for (int i = 0; i < n; i++) {
+                stara[i] = A_(i, j);
+                A_(i, j) = kolumna[i];
+            }
+            try {
+                rozloz();
+            } catch (...) {
+                for (int i = 0; i < n; i++) {
+                    A_(i, j) = stara[i];
+                }
+                throw;
+            }
+            return;
+        }
+
+        for (int i = 0; i < n; i++) {
+            A_(i, j) = kolumna[i];
+            U_(i, j) = kolec[i];
+        }
+        double* u_j = U_.wiersz(j);
+        for (int r = p + 1; r < n; r++) {
+            u_j[kolejnosc_[r]] = 0.0;
+        }
+        u_j[j] = przekatna;
+
+        kolejnosc_.erase(kolejnosc_.begin() + p);
+        kolejnosc_.push_back(j);
+        for (int r = p; r < n; r++) {
+            pozycja_[kolejnosc_[r]] = r;
+        }
+        przeksztalcenia_.push_back(move(e));
+    }
+
+    vector<double> RozkladLUAktualizowany::solve(const vector<double>& b) const {
+        int n = rozmiar();
+        if (b.size() != n) {
+            throw invalid_argument("Nieprawidłowe wymiary macierzy lub wektora");
+        }
+
+        vector<double> x = b;
+        przeksztalc(x);
+        // podstawianie wsteczne w kolejnosci elementow glownych
+        for (int r = n - 1; r >= 0; r--) {
+            int i = kolejnosc_[r];
+            const double* u = U_.wiersz(i);
+            double suma = x[i];
+            for (int s = r + 1; s < n; s++) {
+                suma -= u[kolejnosc_[s]] * x[kolejnosc_[s]];
+            }
+            x[i] = suma / u[i];
+        }
+        return x;
+    }
+}
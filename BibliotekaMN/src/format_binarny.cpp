@@ -0,0 +1,269 @@
+//
+// Created by Szymon Ros on 17/10/2026.
+//
+#include "../include/format_binarny.h"
+#include "../include/uklady_liniowe.h"
+#include <climits>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+using namespace std;
+
+namespace biblioteka_numeryczna {
+    static const char MAGIA[8] = {'B', 'M', 'N', 'B', 'I', 'N', '\0', '\0'};
+    static const uint32_t ZNACZNIK_KOLEJNOSCI = 0x01020304;
+    static const uint32_t TYP_DOUBLE = 1;
+    static const uint32_t TYP_INT32 = 1;
+    static const uint64_t WYROWNANIE = 64;
+
+    static uint64_t wyrownaj(uint64_t przesuniecie) {
+        return (przesuniecie + WYROWNANIE - 1) / WYROWNANIE * WYROWNANIE;
+    }
+
+    Macierz WidokMacierzy::doMacierzy() const {
+        Macierz wynik(wiersze_, kolumny_);
+        for (int i = 0; i < wiersze_; i++) {
+            memcpy(wynik.wiersz(i), wiersz(i), sizeof(double) * kolumny_);
+        }
+        return wynik;
+    }
+
+    MacierzRzadkaCSR WidokCSR::doMacierzyCSR() const {
+        int nnz = liczbaNiezerowych();
+        return MacierzRzadkaCSR(wiersze_, kolumny_,
+                                vector<int>(poczatkiWierszy_, poczatkiWierszy_ + wiersze_ + 1),
+                                vector<int>(indeksyKolumn_, indeksyKolumn_ + nnz),
+                                vector<double>(wartosci_, wartosci_ + nnz));
+    }
+
+    MacierzPasmowa WidokPasmowy::doMacierzyPasmowej() const {
+        MacierzPasmowa wynik(rozmiar_, dolna_, gorna_);
+        memcpy(wynik.dane(), dane_, sizeof(double) * rozmiar_ * szerokosc_);
+        return wynik;
+    }
+
+    PlikBinarny::PlikBinarny(const string& sciezka) : plik_(sciezka) {
+        auto blad = [&](const string& opis) {
+            throw runtime_error("Nieprawidłowy plik binarny " + sciezka + ": " + opis);
+        };
+        uint64_t rozmiarPliku = plik_.rozmiar();
+        if (rozmiarPliku < sizeof(NaglowekBinarny)) {
+            blad("plik krótszy niż nagłówek");
+        }
+        memcpy(&naglowek_, plik_.dane(), sizeof(NaglowekBinarny));
+        const NaglowekBinarny& n = naglowek_;
+
+        if (memcmp(n.magia, MAGIA, sizeof(MAGIA)) != 0) {
+            blad("brak sygnatury BMNBIN");
+        }
+        if (n.znacznikKolejnosci != ZNACZNIK_KOLEJNOSCI) {
+            blad("plik zapisano na maszynie o innej kolejności bajtów");
+        }
+        if (n.wersja == 0 || n.wersja > WERSJA) {
+            blad("nieobsługiwana wersja " + to_string(n.wersja));
+        }
+        if (n.typDanych != TYP_DOUBLE || n.typIndeksow != TYP_INT32) {
+            blad("nieobsługiwany typ danych lub indeksów");
+        }
+        if (n.wiersze < 0 || n.wiersze > INT_MAX || n.kolumny < 0 || n.kolumny > INT_MAX) {
+            blad("nieprawidłowe wymiary macierzy");
+        }
+
+        // sekcja musi lezec w pliku i byc wyrownana do typu elementu
+        auto sprawdzSekcje = [&](uint64_t przesuniecie, uint64_t liczba, uint64_t rozmiarElementu, const char* nazwa) {
+            if (liczba == 0) return;
+            if (przesuniecie < sizeof(NaglowekBinarny) || przesuniecie % rozmiarElementu != 0 ||
+                przesuniecie > rozmiarPliku || liczba > (rozmiarPliku - przesuniecie) / rozmiarElementu) {
+                blad(string("sekcja \"") + nazwa + "\" wychodzi poza plik");
+            }
+        };
+
+        switch (rodzaj()) {
+            case RodzajMacierzy::Gesta:
+                if (n.krok < n.kolumny || n.krok > INT_MAX) {
+                    blad("krok wiersza mniejszy niż liczba kolumn");
+                }
+                sprawdzSekcje(n.przesuniecieDanych, (uint64_t)n.wiersze * n.krok, sizeof(double), "dane");
+                break;
+            case RodzajMacierzy::CSR: {
+                if (n.liczbaNiezerowych < 0 || n.liczbaNiezerowych > INT_MAX) {
+                    blad("nieprawidłowa liczba elementów niezerowych");
+                }
+                sprawdzSekcje(n.przesuniecieDanych, n.liczbaNiezerowych, sizeof(double), "wartości");
+                sprawdzSekcje(n.przesuniecieIndeksow, n.liczbaNiezerowych, sizeof(int32_t), "indeksy kolumn");
+                sprawdzSekcje(n.przesunieciePoczatkow, n.wiersze + 1, sizeof(int32_t), "początki wierszy");
+
+                // solvery czytaja indeksy potem bez sprawdzania; najpierw wszystkie poczatki wierszy,
+                // zeby przebieg po kolumnach nie wyszedl poza sekcje indeksow
+                const int32_t* poczatki = reinterpret_cast<const int32_t*>(sekcja(n.przesunieciePoczatkow));
+                const int32_t* kolumny = reinterpret_cast<const int32_t*>(sekcja(n.przesuniecieIndeksow));
+                if (poczatki[0] != 0 || poczatki[n.wiersze] != n.liczbaNiezerowych) {
+                    blad("niespójne początki wierszy CSR");
+                }
+                for (int64_t i = 0; i < n.wiersze; i++) {
+                    if (poczatki[i] > poczatki[i + 1] || poczatki[i + 1] > n.liczbaNiezerowych) {
+                        blad("niespójne początki wierszy CSR");
+                    }
+                }
+                for (int64_t i = 0; i < n.wiersze; i++) {
+                    for (int32_t p = poczatki[i]; p < poczatki[i + 1]; p++) {
+                        if (kolumny[p] < 0 || kolumny[p] >= n.kolumny) {
+                            blad("indeks kolumny poza zakresem w wierszu " + to_string(i));
+                        }
+                    }
+                }
+                break;
+            }
+            case RodzajMacierzy::Pasmowa:
+                if (n.wiersze != n.kolumny || n.dolna < 0 || n.gorna < 0 ||
+                    n.dolna > INT_MAX / 4 || n.gorna > INT_MAX / 4 || n.krok != 2 * n.dolna + n.gorna + 1) {
+                    blad("nieprawidłowe wymiary macierzy pasmowej");
+                }
+                sprawdzSekcje(n.przesuniecieDanych, (uint64_t)n.wiersze * n.krok, sizeof(double), "dane");
+                break;
+            default:
+                blad("nieznany rodzaj macierzy " + to_string(n.rodzaj));
+        }
+
+        if (n.dlugoscWektora != 0) {
+            if (n.dlugoscWektora != n.wiersze) {
+                blad("długość wektora różna od liczby wierszy");
+            }
+            sprawdzSekcje(n.przesuniecieWektora, n.dlugoscWektora, sizeof(double), "wektor");
+        }
+    }
+
+    WidokMacierzy PlikBinarny::macierzGesta() const {
+        if (rodzaj() != RodzajMacierzy::Gesta) {
+            throw runtime_error("Plik " + plik_.sciezka() + " nie zawiera macierzy gęstej");
+        }
+        return WidokMacierzy(reinterpret_cast<const double*>(sekcja(naglowek_.przesuniecieDanych)),
+                             wiersze(), kolumny(), static_cast<int>(naglowek_.krok));
+    }
+
+    WidokCSR PlikBinarny::macierzCSR() const {
+        if (rodzaj() != RodzajMacierzy::CSR) {
+            throw runtime_error("Plik " + plik_.sciezka() + " nie zawiera macierzy CSR");
+        }
+        return WidokCSR(wiersze(), kolumny(),
+                        reinterpret_cast<const int*>(sekcja(naglowek_.przesunieciePoczatkow)),
+                        reinterpret_cast<const int*>(sekcja(naglowek_.przesuniecieIndeksow)),
+                        reinterpret_cast<const double*>(sekcja(naglowek_.przesuniecieDanych)));
+    }
+
+    WidokPasmowy PlikBinarny::macierzPasmowa() const {
+        if (rodzaj() != RodzajMacierzy::Pasmowa) {
+            throw runtime_error("Plik " + plik_.sciezka() + " nie zawiera macierzy pasmowej");
+        }
+        return WidokPasmowy(reinterpret_cast<const double*>(sekcja(naglowek_.przesuniecieDanych)),
+                            wiersze(), static_cast<int>(naglowek_.dolna), static_cast<int>(naglowek_.gorna));
+    }
+
+    StalyWidokWektora PlikBinarny::widokWektora() const {
+        const double* dane = maWektor() ? reinterpret_cast<const double*>(sekcja(naglowek_.przesuniecieWektora)) : nullptr;
+        return StalyWidokWektora(dane, static_cast<int>(naglowek_.dlugoscWektora), 1);
+    }
+
+    vector<double> PlikBinarny::wektor() const {
+        StalyWidokWektora w = widokWektora();
+        return vector<double>(w.dane(), w.dane() + w.rozmiar());
+    }
+
+    namespace {
+        struct Sekcja {
+            const void* dane;
+            uint64_t bajty;
+            uint64_t* przesuniecie;     // pole nagłówka do uzupełnienia
+        };
+
+        NaglowekBinarny nowyNaglowek(RodzajMacierzy rodzaj, int wiersze, int kolumny, const vector<double>& b) {
+            if (!b.empty() && (int)b.size() != wiersze) {
+                throw invalid_argument("Długość wektora b różna od liczby wierszy macierzy");
+            }
+            NaglowekBinarny n;
+            memset(&n, 0, sizeof(n));
+            memcpy(n.magia, MAGIA, sizeof(MAGIA));
+            n.wersja = PlikBinarny::WERSJA;
+            n.znacznikKolejnosci = ZNACZNIK_KOLEJNOSCI;
+            n.rodzaj = static_cast<uint32_t>(rodzaj);
+            n.typDanych = TYP_DOUBLE;
+            n.typIndeksow = TYP_INT32;
+            n.wyrownanie = WYROWNANIE;
+            n.wiersze = wiersze;
+            n.kolumny = kolumny;
+            n.dlugoscWektora = b.size();
+            return n;
+        }
+
+        void zapiszPlik(const string& sciezka, NaglowekBinarny& n, vector<Sekcja> sekcje, const vector<double>& b) {
+            sekcje.push_back({b.data(), sizeof(double) * b.size(), &n.przesuniecieWektora});
+            uint64_t przesuniecie = wyrownaj(sizeof(NaglowekBinarny));
+            for (Sekcja& s : sekcje) {
+                if (s.bajty == 0) continue;
+                *s.przesuniecie = przesuniecie;
+                przesuniecie = wyrownaj(przesuniecie + s.bajty);
+            }
+
+            ofstream plik(sciezka, ios::binary | ios::trunc);
+            if (!plik) {
+                throw runtime_error("Nie można utworzyć pliku: " + sciezka);
+            }
+            plik.write(reinterpret_cast<const char*>(&n), sizeof(n));
+            static const char zera[WYROWNANIE] = {};
+            uint64_t pozycja = sizeof(n);
+            for (const Sekcja& s : sekcje) {
+                if (s.bajty == 0) continue;
+                plik.write(zera, *s.przesuniecie - pozycja);
+                plik.write(static_cast<const char*>(s.dane), s.bajty);
+                pozycja = *s.przesuniecie + s.bajty;
+            }
+            if (!plik) {
+                throw runtime_error("Błąd zapisu pliku: " + sciezka);
+            }
+        }
+    }
+
+    void zapiszBinarnie(const string& sciezka, const Macierz& A, const vector<double>& b) {
+        NaglowekBinarny n = nowyNaglowek(RodzajMacierzy::Gesta, A.wiersze(), A.kolumny(), b);
+        n.krok = A.krok();
+        // bufor Macierz zapisywany jak jest: wiersze zachowuja wyrownanie do 64 B po zmapowaniu
+        zapiszPlik(sciezka, n, {{A.dane(), sizeof(double) * A.wiersze() * A.krok(), &n.przesuniecieDanych}}, b);
+    }
+
+    void zapiszBinarnie(const string& sciezka, const MacierzRzadkaCSR& A, const vector<double>& b) {
+        NaglowekBinarny n = nowyNaglowek(RodzajMacierzy::CSR, A.wiersze(), A.kolumny(), b);
+        n.liczbaNiezerowych = A.liczbaNiezerowych();
+        zapiszPlik(sciezka, n, {{A.wartosci().data(), sizeof(double) * A.wartosci().size(), &n.przesuniecieDanych},
+                                {A.indeksyKolumn().data(), sizeof(int32_t) * A.indeksyKolumn().size(), &n.przesuniecieIndeksow},
+                                {A.poczatkiWierszy().data(), sizeof(int32_t) * A.poczatkiWierszy().size(), &n.przesunieciePoczatkow}}, b);
+    }
+
+    void zapiszBinarnie(const string& sciezka, const MacierzPasmowa& A, const vector<double>& b) {
+        NaglowekBinarny n = nowyNaglowek(RodzajMacierzy::Pasmowa, A.rozmiar(), A.rozmiar(), b);
+        n.krok = A.szerokosc();
+        n.dolna = A.dolna();
+        n.gorna = A.gorna();
+        zapiszPlik(sciezka, n, {{A.dane(), sizeof(double) * A.rozmiar() * A.szerokosc(), &n.przesuniecieDanych}}, b);
+    }
+
+    void konwertujNaBinarny(const string& plikTekstowy, const string& plikBinarny, RodzajMacierzy rodzaj) {
+        Macierz A;
+        vector<double> b;
+        int N;
+        wczytajDaneMapowane(plikTekstowy, A, b, N);
+        switch (rodzaj) {
+            case RodzajMacierzy::Gesta:
+                zapiszBinarnie(plikBinarny, A, b);
+                break;
+            case RodzajMacierzy::CSR:
+                zapiszBinarnie(plikBinarny, MacierzRzadkaCSR::zGestej(A), b);
+                break;
+            case RodzajMacierzy::Pasmowa:
+                zapiszBinarnie(plikBinarny, MacierzPasmowa::zGestej(A), b);
+                break;
+            default:
+                throw invalid_argument("Nieznany rodzaj macierzy");
+        }
+    }
+}
@@ -0,0 +1,303 @@
+//
+// Created by Szymon Ros on 17/10/2026.
+//
+#include "../include/format_mtx.h"
+#include "../include/plik_mapowany.h"
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <climits>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+
+using namespace std;
+
+namespace biblioteka_numeryczna {
+    namespace {
+        enum class Symetria { Ogolna, Symetryczna, Antysymetryczna };
+
+        // czyta plik linia po linii bezposrednio ze zmapowanej pamieci
+        class CzytnikLinii {
+        public:
+            CzytnikLinii(string_view tekst, const string& nazwa)
+                : p_(tekst.data()), koniec_(tekst.data() + tekst.size()), nazwa_(nazwa) {}
+
+            // kolejna linia bez znaku konca linii; false na koncu pliku
+            bool linia(string_view& wynik) {
+                if (p_ >= koniec_) return false;
+                const char* k = static_cast<const char*>(memchr(p_, '\n', koniec_ - p_));
+                if (k == nullptr) k = koniec_;
+                const char* koniecTresci = (k > p_ && k[-1] == '\r') ? k - 1 : k;
+                wynik = string_view(p_, koniecTresci - p_);
+                p_ = k < koniec_ ? k + 1 : k;
+                numer_++;
+                return true;
+            }
+
+            // kolejna linia z danymi (pomija puste linie i komentarze "%")
+            bool liniaDanych(string_view& wynik) {
+                while (linia(wynik)) {
+                    size_t i = wynik.find_first_not_of(" \t");
+                    if (i != string_view::npos && wynik[i] != '%') return true;
+                }
+                return false;
+            }
+
+            struct Pozycja {
+                const char* p;
+                long long numer;
+            };
+            Pozycja pozycja() const { return {p_, numer_}; }
+            void wroc(Pozycja poz) {
+                p_ = poz.p;
+                numer_ = poz.numer;
+            }
+
+            [[noreturn]] void blad(const string& komunikat) const {
+                throw runtime_error(nazwa_ + ":" + to_string(numer_) + ": " + komunikat);
+            }
+
+        private:
+            const char* p_;
+            const char* koniec_;
+            string nazwa_;
+            long long numer_ = 0;
+        };
+
+        // kolejne slowo linii; pusty widok gdy linia sie skonczyla
+        string_view slowo(string_view& linia) {
+            size_t poczatek = linia.find_first_not_of(" \t");
+            if (poczatek == string_view::npos) {
+                linia = string_view();
+                return string_view();
+            }
+            size_t koniec = linia.find_first_of(" \t", poczatek);
+            if (koniec == string_view::npos) koniec = linia.size();
+            string_view wynik = linia.substr(poczatek, koniec - poczatek);
+            linia.remove_prefix(koniec);
+            return wynik;
+        }
+
+        string maleLitery(string_view s) {
+            string wynik(s);
+            for (char& c : wynik) c = tolower((unsigned char)c);
+            return wynik;
+        }
+
+        template <typename T>
+        T liczba(CzytnikLinii& czytnik, string_view& linia, const char* co) {
+            string_view s = slowo(linia);
+            if (!s.empty() && s[0] == '+') s.remove_prefix(1);
+            T wartosc{};
+            from_chars_result wynik = from_chars(s.data(), s.data() + s.size(), wartosc);
+            if (s.empty() || wynik.ec != errc() || wynik.ptr != s.data() + s.size()) {
+                czytnik.blad(string("oczekiwano ") + co + ", znaleziono \"" + string(s) + "\"");
+            }
+            return wartosc;
+        }
+
+        void sprawdzKoniecLinii(CzytnikLinii& czytnik, string_view linia) {
+            string_view reszta = slowo(linia);
+            if (!reszta.empty()) {
+                czytnik.blad("nadmiarowe dane w linii: \"" + string(reszta) + "\"");
+            }
+        }
+
+        // wiersz i kolumna elementu (od 1 w pliku, zwracane od 0)
+        pair<int, int> pozycjaElementu(CzytnikLinii& czytnik, string_view& linia, long long wiersze, long long kolumny) {
+            long long i = liczba<long long>(czytnik, linia, "numeru wiersza");
+            long long j = liczba<long long>(czytnik, linia, "numeru kolumny");
+            if (i < 1 || i > wiersze || j < 1 || j > kolumny) {
+                czytnik.blad("element (" + to_string(i) + ", " + to_string(j) + ") poza wymiarami macierzy");
+            }
+            return {static_cast<int>(i - 1), static_cast<int>(j - 1)};
+        }
+
+        void zapiszLiczbe(ofstream& plik, double wartosc) {
+            char bufor[32];
+            to_chars_result wynik = to_chars(bufor, bufor + sizeof(bufor), wartosc);
+            plik.write(bufor, wynik.ptr - bufor);
+        }
+    }
+
+    MacierzRzadkaCSR wczytajMatrixMarket(const string& sciezka) {
+        PlikMapowany plik(sciezka);
+        CzytnikLinii czytnik(plik.tekst(), sciezka);
+
+        string_view linia;
+        if (!czytnik.linia(linia) || maleLitery(slowo(linia)) != "%%matrixmarket") {
+            czytnik.blad("brak nagłówka %%MatrixMarket");
+        }
+        string obiekt = maleLitery(slowo(linia));
+        string format = maleLitery(slowo(linia));
+        string pole = maleLitery(slowo(linia));
+        string symetria = maleLitery(slowo(linia));
+        if (obiekt != "matrix") {
+            czytnik.blad("nieobsługiwany obiekt \"" + obiekt + "\" (oczekiwano matrix)");
+        }
+        if (format != "coordinate") {
+            czytnik.blad("nieobsługiwany format \"" + format + "\" (macierz rzadka wymaga coordinate)");
+        }
+        if (pole != "real" && pole != "integer" && pole != "pattern") {
+            czytnik.blad("nieobsługiwane pole \"" + pole + "\" (obsługiwane: real, integer, pattern)");
+        }
+        Symetria rodzajSymetrii;
+        if (symetria == "general") {
+            rodzajSymetrii = Symetria::Ogolna;
+        } else if (symetria == "symmetric") {
+            rodzajSymetrii = Symetria::Symetryczna;
+        } else if (symetria == "skew-symmetric") {
+            rodzajSymetrii = Symetria::Antysymetryczna;
+        } else {
+            czytnik.blad("nieobsługiwana symetria \"" + symetria + "\"");
+        }
+        bool wzor = pole == "pattern";
+
+        if (!czytnik.liniaDanych(linia)) {
+            czytnik.blad("brak linii z wymiarami macierzy");
+        }
+        long long wiersze = liczba<long long>(czytnik, linia, "liczby wierszy");
+        long long kolumny = liczba<long long>(czytnik, linia, "liczby kolumn");
+        long long liczbaElementow = liczba<long long>(czytnik, linia, "liczby elementów");
+        sprawdzKoniecLinii(czytnik, linia);
+        if (wiersze < 0 || wiersze >= INT_MAX || kolumny < 0 || kolumny >= INT_MAX || liczbaElementow < 0) {
+            czytnik.blad("nieprawidłowe wymiary macierzy");
+        }
+        if (rodzajSymetrii != Symetria::Ogolna && wiersze != kolumny) {
+            czytnik.blad("macierz symetryczna musi być kwadratowa");
+        }
+        CzytnikLinii::Pozycja poczatekDanych = czytnik.pozycja();
+
+        // przebieg 1: liczba elementow w kazdym wierszu (z odbiciem symetrycznym)
+        vector<int> poczatki(wiersze + 1, 0);
+        long long niezerowe = 0;
+        for (long long k = 0; k < liczbaElementow; k++) {
+            if (!czytnik.liniaDanych(linia)) {
+                czytnik.blad("oczekiwano " + to_string(liczbaElementow) + " elementów, znaleziono " + to_string(k));
+            }
+            pair<int, int> ij = pozycjaElementu(czytnik, linia, wiersze, kolumny);
+            if (!wzor) {
+                liczba<double>(czytnik, linia, "wartości");
+            }
+            sprawdzKoniecLinii(czytnik, linia);
+            poczatki[ij.first + 1]++;
+            niezerowe++;
+            if (rodzajSymetrii != Symetria::Ogolna && ij.first != ij.second) {
+                poczatki[ij.second + 1]++;
+                niezerowe++;
+            }
+        }
+        if (czytnik.liniaDanych(linia)) {
+            czytnik.blad("nadmiarowe dane po " + to_string(liczbaElementow) + " elementach");
+        }
+        if (niezerowe > INT_MAX) {
+            throw runtime_error(sciezka + ": liczba elementów przekracza zakres indeksów CSR");
+        }
+        for (long long i = 0; i < wiersze; i++) {
+            poczatki[i + 1] += poczatki[i];
+        }
+
+        // przebieg 2: elementy wpisywane od razu na miejsce w tablicach CSR
+        vector<int> indeksyKolumn(niezerowe);
+        vector<double> wartosci(niezerowe);
+        vector<int> wolne(poczatki.begin(), poczatki.end() - 1);
+        czytnik.wroc(poczatekDanych);
+        for (long long k = 0; k < liczbaElementow; k++) {
+            czytnik.liniaDanych(linia);
+            pair<int, int> ij = pozycjaElementu(czytnik, linia, wiersze, kolumny);
+            double wartosc = wzor ? 1.0 : liczba<double>(czytnik, linia, "wartości");
+            int p = wolne[ij.first]++;
+            indeksyKolumn[p] = ij.second;
+            wartosci[p] = wartosc;
+            if (rodzajSymetrii != Symetria::Ogolna && ij.first != ij.second) {
+                p = wolne[ij.second]++;
+                indeksyKolumn[p] = ij.first;
+                wartosci[p] = rodzajSymetrii == Symetria::Symetryczna ? wartosc : -wartosc;
+            }
+        }
+
+        // sortowanie kolumn w wierszach i sumowanie powtorzen; bufor ma dlugosc najdluzszego wiersza
+        vector<pair<int, double>> wiersz;
+        int zapisane = 0;
+        for (long long i = 0; i < wiersze; i++) {
+            wiersz.clear();
+            for (int p = poczatki[i]; p < poczatki[i + 1]; p++) {
+                wiersz.push_back({indeksyKolumn[p], wartosci[p]});
+            }
+            sort(wiersz.begin(), wiersz.end(),
+                 [](const pair<int, double>& a, const pair<int, double>& b) { return a.first < b.first; });
+            poczatki[i] = zapisane;
+            for (size_t k = 0; k < wiersz.size(); k++) {
+                if (k > 0 && wiersz[k].first == wiersz[k - 1].first) {
+                    wartosci[zapisane - 1] += wiersz[k].second;
+                } else {
+                    indeksyKolumn[zapisane] = wiersz[k].first;
+                    wartosci[zapisane] = wiersz[k].second;
+                    zapisane++;
+                }
+            }
+        }
+        poczatki[wiersze] = zapisane;
+        indeksyKolumn.resize(zapisane);
+        wartosci.resize(zapisane);
+
+        return MacierzRzadkaCSR(static_cast<int>(wiersze), static_cast<int>(kolumny),
+                                move(poczatki), move(indeksyKolumn), move(wartosci));
+    }
+
+    void zapiszMatrixMarket(const string& sciezka, const MacierzRzadkaCSR& A, bool symetryczna) {
+        if (symetryczna && A.wiersze() != A.kolumny()) {
+            throw invalid_argument("Macierz symetryczna musi być kwadratowa");
+        }
+        ofstream plik(sciezka, ios::binary | ios::trunc);
+        if (!plik) {
+            throw runtime_error("Nie można utworzyć pliku: " + sciezka);
+        }
+        const vector<int>& poczatki = A.poczatkiWierszy();
+        const vector<int>& kolumny = A.indeksyKolumn();
+        const vector<double>& wartosci = A.wartosci();
+
+        long long liczbaElementow = A.liczbaNiezerowych();
+        if (symetryczna) {
+            liczbaElementow = 0;
+            for (int i = 0; i < A.wiersze(); i++) {
+                for (int p = poczatki[i]; p < poczatki[i + 1]; p++) {
+                    liczbaElementow += kolumny[p] <= i;
+                }
+            }
+        }
+
+        plik << "%%MatrixMarket matrix coordinate real " << (symetryczna ? "symmetric" : "general") << "\n";
+        plik << A.wiersze() << " " << A.kolumny() << " " << liczbaElementow << "\n";
+        for (int i = 0; i < A.wiersze(); i++) {
+            for (int p = poczatki[i]; p < poczatki[i + 1]; p++) {
+                if (symetryczna && kolumny[p] > i) continue;
+                plik << i + 1 << " " << kolumny[p] + 1 << " ";
+                zapiszLiczbe(plik, wartosci[p]);
+                plik << "\n";
+            }
+        }
+        if (!plik) {
+            throw runtime_error("Błąd zapisu pliku: " + sciezka);
+        }
+    }
+
+    void zapiszMatrixMarket(const string& sciezka, const vector<double>& x) {
+        ofstream plik(sciezka, ios::binary | ios::trunc);
+        if (!plik) {
+            throw runtime_error("Nie można utworzyć pliku: " + sciezka);
+        }
+        plik << "%%MatrixMarket matrix array real general\n";
+        plik << x.size() << " 1\n";
+        for (double wartosc : x) {
+            zapiszLiczbe(plik, wartosc);
+            plik << "\n";
+        }
+        if (!plik) {
+            throw runtime_error("Błąd zapisu pliku: " + sciezka);
+        }
+    }
+}
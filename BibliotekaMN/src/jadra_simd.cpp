@@ -0,0 +1,214 @@
+//
+// Created by Szymon Ros on 17/10/2026.
+//
+#include "../include/jadra_simd.h"
+#include <atomic>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define BIBLIOTEKA_MN_X86
+#include <immintrin.h>
+#endif
+
+using namespace std;
+
+namespace biblioteka_numeryczna {
+    static void axpySkalarne(int n, double alfa, const double* x, double* y) {
+        for (int i = 0; i < n; i++) {
+            y[i] += alfa * x[i];
+        }
+    }
+
+    static double iloczynSkalarnySkalarny(int n, const double* x, const double* y) {
+        double suma = 0.0;
+        for (int i = 0; i < n; i++) {
+            suma += x[i] * y[i];
+        }
+        return suma;
+    }
+
+#ifdef BIBLIOTEKA_MN_X86
+    __attribute__((target("avx2,fma")))
+    static void axpyAVX2(int n, double alfa, const double* x, double* y) {
+        __m256d a = _mm256_set1_pd(alfa);
+        int i = 0;
+        for (; i + 8 <= n; i += 8) {
+            __m256d y0 = _mm256_fmadd_pd(a, _mm256_loadu_pd(x + i), _mm256_loadu_pd(y + i));
+            __m256d y1 = _mm256_fmadd_pd(a, _mm256_loadu_pd(x + i + 4), _mm256_loadu_pd(y + i + 4));
+            _mm256_storeu_pd(y + i, y0);
+            _mm256_storeu_pd(y + i + 4, y1);
+        }
+        for (; i + 4 <= n; i += 4) {
+            _mm256_storeu_pd(y + i, _mm256_fmadd_pd(a, _mm256_loadu_pd(x + i), _mm256_loadu_pd(y + i)));
+        }
+        for (; i < n; i++) {
+            y[i] += alfa * x[i];
+        }
+    }
+
+    __attribute__((target("avx2,fma")))
+    static double iloczynSkalarnyAVX2(int n, const double* x, const double* y) {
+        __m256d s0 = _mm256_setzero_pd();
+        __m256d s1 = _mm256_setzero_pd();
+        int i = 0;
+        for (; i + 8 <= n; i += 8) {
+            s0 = _mm256_fmadd_pd(_mm256_loadu_pd(x + i), _mm256_loadu_pd(y + i), s0);
+            s1 = _mm256_fmadd_pd(_mm256_loadu_pd(x + i + 4), _mm256_loadu_pd(y + i + 4), s1);
+        }
+        for (; i + 4 <= n; i += 4) {
+            s0 = _mm256_fmadd_pd(_mm256_loadu_pd(x + i), _mm256_loadu_pd(y + i), s0);
+        }
+        s0 = _mm256_add_pd(s0, s1);
+        __m128d polowa = _mm_add_pd(_mm256_castpd256_pd128(s0), _mm256_extractf128_pd(s0, 1));
+        double suma = _mm_cvtsd_f64(_mm_add_sd(polowa, _mm_unpackhi_pd(polowa, polowa)));
+        for (; i < n; i++) {
+            suma += x[i] * y[i];
+        }
+        return suma;
+    }
+
+    __attribute__((target("avx512f")))
+    static void axpyAVX512(int n, double alfa, const double* x, double* y) {
+        __m512d a = _mm512_set1_pd(alfa);
+        int i = 0;
+        for (; i + 16 <= n; i += 16) {
+            __m512d y0 = _mm512_fmadd_pd(a, _mm512_loadu_pd(x + i), _mm512_loadu_pd(y + i));
+            __m512d y1 = _mm512_fmadd_pd(a, _mm512_loadu_pd(x + i + 8), _mm512_loadu_pd(y + i + 8));
+            _mm512_storeu_pd(y + i, y0);
+            _mm512_storeu_pd(y + i + 8, y1);
+        }
+        for (; i + 8 <= n; i += 8) {
+            _mm512_storeu_pd(y + i, _mm512_fmadd_pd(a, _mm512_loadu_pd(x + i), _mm512_loadu_pd(y + i)));
+        }
+        if (i < n) {
+            __mmask8 maska = (__mmask8)((1u << (n - i)) - 1);
+            __m512d wynik = _mm512_fmadd_pd(a, _mm512_mask_loadu_pd(_mm512_setzero_pd(), maska, x + i), _mm512_mask_loadu_pd(_mm512_setzero_pd(), maska, y + i));
+            _mm512_mask_storeu_pd(y + i, maska, wynik);
+        }
+    }
+
+    __attribute__((target("avx512f")))
+    static double iloczynSkalarnyAVX512(int n, const double* x, const double* y) {
+        __m512d s0 = _mm512_setzero_pd();
+        __m512d s1 = _mm512_setzero_pd();
+        int i = 0;
+        for (; i + 16 <= n; i += 16) {
+            s0 = _mm512_fmadd_pd(_mm512_loadu_pd(x + i), _mm512_loadu_pd(y + i), s0);
+            s1 = _mm512_fmadd_pd(_mm512_loadu_pd(x + i + 8), _mm512_loadu_pd(y + i + 8), s1);
+        }
+        for (; i + 8 <= n; i += 8) {
+            s0 = _mm512_fmadd_pd(_mm512_loadu_pd(x + i), _mm512_loadu_pd(y + i), s0);
+        }
+        if (i < n) {
+            __mmask8 maska = (__mmask8)((1u << (n - i)) - 1);
+            s1 = _mm512_fmadd_pd(_mm512_mask_loadu_pd(_mm512_setzero_pd(), maska, x + i), _mm512_mask_loadu_pd(_mm512_setzero_pd(), maska, y + i), s1);
+        }
+        return _mm512_reduce_add_pd(_mm512_add_pd(s0, s1));
+    }
+#endif
+
+    static SciezkaSimd najlepszaObslugiwana() {
+#ifdef BIBLIOTEKA_MN_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f")) {
+            return SciezkaSimd::AVX512;
+        }
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+            return SciezkaSimd::AVX2;
+        }
+#endif
+        return SciezkaSimd::Skalarna;
+    }
+
+    using FunkcjaAxpy = void (*)(int, double, const double*, double*);
+    using FunkcjaIloczynu = double (*)(int, const double*, const double*);
+
+    struct Jadra {
+        SciezkaSimd sciezka;
+        FunkcjaAxpy axpy;
+        FunkcjaIloczynu iloczyn;
+    };
+
+    static Jadra jadraDla(SciezkaSimd sciezka) {
+        switch (sciezka) {
+#ifdef BIBLIOTEKA_MN_X86
+            case SciezkaSimd::AVX512:
+                return {SciezkaSimd::AVX512, axpyAVX512, iloczynSkalarnyAVX512};
+            case SciezkaSimd::AVX2:
+                return {SciezkaSimd::AVX2, axpyAVX2, iloczynSkalarnyAVX2};
+#endif
+            default:
+                return {SciezkaSimd::Skalarna, axpySkalarne, iloczynSkalarnySkalarny};
+        }
+    }
+
+    // wskazniki ustawiane raz przy pierwszym uzyciu; wymusSciezkeSimd moze je podmienic
+    static atomic<FunkcjaAxpy> aktywneAxpy{nullptr};
+    static atomic<FunkcjaIloczynu> aktywnyIloczyn{nullptr};
+    static atomic<SciezkaSimd> aktywnaSciezka{SciezkaSimd::Skalarna};
+
+    static void ustawJadra(const Jadra& jadra) {
+        aktywnaSciezka = jadra.sciezka;
+        aktywnyIloczyn = jadra.iloczyn;
+        aktywneAxpy = jadra.axpy;
+    }
+
+    static void upewnijSieZeWybrane() {
+        if (aktywneAxpy.load(memory_order_acquire) == nullptr) {
+            ustawJadra(jadraDla(najlepszaObslugiwana()));
+        }
+    }
+
+    SciezkaSimd aktywnaSciezkaSimd() {
+        upewnijSieZeWybrane();
+        return aktywnaSciezka;
+    }
+
+    string nazwaSciezkiSimd(SciezkaSimd sciezka) {
+        switch (sciezka) {
+            case SciezkaSimd::AVX512:
+                return "AVX-512";
+            case SciezkaSimd::AVX2:
+                return "AVX2";
+            default:
+                return "skalarna";
+        }
+    }
+
+    SciezkaSimd wymusSciezkeSimd(SciezkaSimd sciezka) {
+        SciezkaSimd najlepsza = najlepszaObslugiwana();
+        if (static_cast<int>(sciezka) > static_cast<int>(najlepsza)) {
+            sciezka = najlepsza;
+        }
+        ustawJadra(jadraDla(sciezka));
+        return aktywnaSciezka;
+    }
+
+    void axpy(int n, double alfa, const double* x, double* y) {
+        upewnijSieZeWybrane();
+        aktywneAxpy.load(memory_order_relaxed)(n, alfa, x, y);
+    }
+
+    double iloczynSkalarny(int n, const double* x, const double* y) {
+        upewnijSieZeWybrane();
+        return aktywnyIloczyn.load(memory_order_relaxed)(n, x, y);
+    }
+
+    void podstawianieWPrzod(const Macierz& L, double* b, bool jedynkiNaPrzekatnej) {
+        int n = L.wiersze();
+        for (int i = 0; i < n; i++) {
+            const double* wiersz_i = L.wiersz(i);
+            b[i] -= iloczynSkalarny(i, wiersz_i, b);
+            if (!jedynkiNaPrzekatnej) {
+                b[i] /= wiersz_i[i];
+            }
+        }
+    }
+
+    void podstawianieWstecz(const Macierz& U, double* b) {
+        int n = U.wiersze();
+        for (int i = n - 1; i >= 0; i--) {
+            const double* wiersz_i = U.wiersz(i);
+            b[i] = (b[i] - iloczynSkalarny(n - i - 1, wiersz_i + i + 1, b + i + 1)) / wiersz_i[i];
+        }
+    }
+}
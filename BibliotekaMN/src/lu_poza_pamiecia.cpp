@@ -0,0 +1,302 @@
+//
+// Created by Szymon Ros on 17/10/2026.
+//
+#include "../include/lu_poza_pamiecia.h"
+#include "../include/jadra_simd.h"
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <future>
+#include <stdexcept>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#define BIBLIOTEKA_MN_MMAP 1
+#else
+#include <fstream>
+#include <mutex>
+#endif
+
+using namespace std;
+
+namespace biblioteka_numeryczna {
+    // plik roboczy z czynnikami LU; na POSIX zmapowany do zapisu (MAP_SHARED), odczyt i zapis to memcpy
+    class RozkladLUPozaPamiecia::PlikRoboczy {
+    public:
+        PlikRoboczy(const string& sciezka, size_t liczby) : sciezka_(sciezka), bajty_(liczby * sizeof(double)) {
+#ifdef BIBLIOTEKA_MN_MMAP
+            int fd = open(sciezka.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0600);
+            if (fd < 0) {
+                throw runtime_error("Nie można utworzyć pliku roboczego: " + sciezka);
+            }
+            if (ftruncate(fd, bajty_) != 0) {
+                close(fd);
+                remove(sciezka.c_str());
+                throw runtime_error("Brak miejsca na plik roboczy: " + sciezka);
+            }
+            if (bajty_ > 0) {
+                void* p = mmap(nullptr, bajty_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+                if (p == MAP_FAILED) {
+                    close(fd);
+                    remove(sciezka.c_str());
+                    throw runtime_error("Nie można zmapować pliku roboczego: " + sciezka);
+                }
+                dane_ = static_cast<double*>(p);
+            }
+            close(fd);
+#else
+            plik_.open(sciezka, ios::in | ios::out | ios::binary | ios::trunc);
+            if (!plik_) {
+                throw runtime_error("Nie można utworzyć pliku roboczego: " + sciezka);
+            }
+#endif
+        }
+
+        ~PlikRoboczy() {
+#ifdef BIBLIOTEKA_MN_MMAP
+            if (dane_ != nullptr) {
+                munmap(dane_, bajty_);
+            }
+#else
+            plik_.close();
+#endif
+            remove(sciezka_.c_str());
+        }
+
+        void wczytaj(size_t od, double* cel, size_t ile) const {
+#ifdef BIBLIOTEKA_MN_MMAP
+            memcpy(cel, dane_ + od, ile * sizeof(double));
+#else
+            lock_guard<mutex> blokada(blokada_);
+            plik_.seekg(od * sizeof(double));
+            plik_.read(reinterpret_cast<char*>(cel), ile * sizeof(double));
+#endif
+        }
+
+        void zapisz(size_t od, const double* zrodlo, size_t ile) {
+#ifdef BIBLIOTEKA_MN_MMAP
+            memcpy(dane_ + od, zrodlo, ile * sizeof(double));
+#else
+            lock_guard<mutex> blokada(blokada_);
+            plik_.seekp(od * sizeof(double));
+            plik_.write(reinterpret_cast<const char*>(zrodlo), ile * sizeof(double));
+#endif
+        }
+
+    private:
+        string sciezka_;
+        size_t bajty_;
+#ifdef BIBLIOTEKA_MN_MMAP
+        double* dane_ = nullptr;
+#else
+        mutable fstream plik_;
+        mutable mutex blokada_;
+#endif
+    };
+
+    static string nazwaPlikuTymczasowego() {
+        static atomic<unsigned> licznik{0};
+        long long znacznik = chrono::steady_clock::now().time_since_epoch().count();
+        string nazwa = "bibliotekaMN_lu_" + to_string(znacznik) + "_" + to_string(licznik++) + ".tmp";
+        return (filesystem::temp_directory_path() / nazwa).string();
+    }
+
+    // przechodzi po panelach w zadanej kolejnosci; gdy wyprzedzajace, kolejny panel jest
+    // wczytywany w osobnym watku do drugiego bufora w czasie obliczen na biezacym
+    template <typename Wczytaj, typename Funkcja>
+    static void przejdzPanele(const vector<int>& panele, vector<double>& bufor, vector<double>& zapas,
+                              bool wyprzedzajace, Wczytaj wczytaj, Funkcja funkcja) {
+        if (panele.empty()) return;
+        wczytaj(panele[0], bufor.data());
+        for (size_t k = 0; k < panele.size(); k++) {
+            future<void> nastepny;
+            bool jestNastepny = k + 1 < panele.size();
+            if (jestNastepny && wyprzedzajace) {
+                double* cel = zapas.data();
+                int p = panele[k + 1];
+                nastepny = async(launch::async, [&wczytaj, p, cel] { wczytaj(p, cel); });
+            }
+            funkcja(panele[k], bufor.data());
+            if (jestNastepny) {
+                if (wyprzedzajace) {
+                    nastepny.get();
+                } else {
+                    wczytaj(panele[k + 1], zapas.data());
+                }
+                bufor.swap(zapas);
+            }
+        }
+    }
+
+    RozkladLUPozaPamiecia::RozkladLUPozaPamiecia(const WidokMacierzy& A, const UstawieniaPozaPamiecia& ustawienia)
+        : n_(A.wiersze()), szerokosc_(1), wyprzedzajace_(ustawienia.wczytywanieWyprzedzajace) {
+        if (A.wiersze() != A.kolumny()) {
+            throw invalid_argument("Macierz musi być kwadratowa");
+        }
+        size_t minimum = 3 * sizeof(double) * static_cast<size_t>(max(n_, 1));
+        if (ustawienia.budzetPamieci < minimum) {
+            throw invalid_argument("Budżet pamięci za mały: potrzeba co najmniej " + to_string(minimum) + " B");
+        }
+        szerokosc_ = static_cast<int>(min<size_t>(max(n_, 1), ustawienia.budzetPamieci / minimum));
+
+        string sciezka = ustawienia.plikRoboczy.empty() ? nazwaPlikuTymczasowego() : ustawienia.plikRoboczy;
+        plik_ = make_unique<PlikRoboczy>(sciezka, static_cast<size_t>(n_) * n_);
+        rozloz(A);
+    }
+
+    RozkladLUPozaPamiecia::RozkladLUPozaPamiecia(const Macierz& A, const UstawieniaPozaPamiecia& ustawienia)
+        : RozkladLUPozaPamiecia(WidokMacierzy(A.dane(), A.wiersze(), A.kolumny(), A.krok()), ustawienia) {}
+
+    RozkladLUPozaPamiecia::~RozkladLUPozaPamiecia() = default;
+
+    // panel p zajmuje w pliku n * szerokosc liczb od pozycji n * poczatekPanelu(p), wierszami
+    void RozkladLUPozaPamiecia::wczytajPanel(int p, double* bufor) const {
+        plik_->wczytaj(static_cast<size_t>(n_) * poczatekPanelu(p), bufor, static_cast<size_t>(n_) * szerokoscPanelu(p));
+    }
+
+    void RozkladLUPozaPamiecia::zapiszPanel(int p, const double* bufor) {
+        plik_->zapisz(static_cast<size_t>(n_) * poczatekPanelu(p), bufor, static_cast<size_t>(n_) * szerokoscPanelu(p));
+    }
+
+    void RozkladLUPozaPamiecia::rozloz(const WidokMacierzy& A) {
+        int n = n_;
+        int liczba = liczbaPaneli();
+        if (liczba == 0) {
+            return;
+        }
+        size_t rozmiarBufora = static_cast<size_t>(n) * szerokosc_;
+        vector<double> biezacy(rozmiarBufora), bufor(rozmiarBufora), zapas(rozmiarBufora);
+        auto wczytaj = [this](int p, double* cel) { wczytajPanel(p, cel); };
+        auto zamienWiersze = [](double* panel, int w, int a, int b) {
+            swap_ranges(panel + static_cast<size_t>(a) * w, panel + static_cast<size_t>(a + 1) * w,
+                        panel + static_cast<size_t>(b) * w);
+        };
+
+        // przepisanie macierzy do ukladu panelowego
+        for (int p = 0; p < liczba; p++) {
+            int c0 = poczatekPanelu(p), w = szerokoscPanelu(p);
+            for (int i = 0; i < n; i++) {
+                memcpy(biezacy.data() + static_cast<size_t>(i) * w, A.wiersz(i) + c0, sizeof(double) * w);
+            }
+            zapiszPanel(p, biezacy.data());
+        }
+
+        zamiany_.resize(n);
+        vector<int> wczesniejsze;
+        for (int k = 0; k < liczba; k++) {
+            int c0 = poczatekPanelu(k), w = szerokoscPanelu(k);
+            double* P = biezacy.data();
+            wczytajPanel(k, P);
+            for (int r = 0; r < c0; r++) {
+                if (zamiany_[r] != r) zamienWiersze(P, w, r, zamiany_[r]);
+            }
+
+            // wklad wczesniejszych paneli: U_jk = L_jj^-1 A_jk, A_k -= L_j U_jk ponizej bloku j
+            przejdzPanele(wczesniejsze, bufor, zapas, wyprzedzajace_, wczytaj, [&](int j, double* L) {
+                int d0 = poczatekPanelu(j), wj = szerokoscPanelu(j), d1 = d0 + wj;
+                // zamiany z paneli pozniejszych niz j dotycza tylko wierszy >= d1
+                for (int r = d1; r < c0; r++) {
+                    if (zamiany_[r] != r) zamienWiersze(L, wj, r, zamiany_[r]);
+                }
+                for (int i = d0 + 1; i < n; i++) {
+                    const double* wiersz_L = L + static_cast<size_t>(i) * wj;
+                    double* wiersz_P = P + static_cast<size_t>(i) * w;
+                    for (int t = d0; t < min(i, d1); t++) {
+                        axpy(w, -wiersz_L[t - d0], P + static_cast<size_t>(t) * w, wiersz_P);
+                    }
+                }
+            });
+
+            // rozklad panelu z czesciowym wyborem elementu glownego
+            for (int kk = 0; kk < w; kk++) {
+                int c = c0 + kk;
+                double max_val = 0.0;
+                int max_idx = c;
+                for (int i = c; i < n; i++) {
+                    double abs_val = fabs(P[static_cast<size_t>(i) * w + kk]);
+                    if (abs_val > max_val) {
+                        max_val = abs_val;
+                        max_idx = i;
+                    }
+                }
+                if (max_val < 1e-10) {
+                    throw runtime_error("Macierz jest osobliwa");
+                }
+                zamiany_[c] = max_idx;
+                if (max_idx != c) zamienWiersze(P, w, c, max_idx);
+
+                const double* wiersz_c = P + static_cast<size_t>(c) * w;
+                for (int i = c + 1; i < n; i++) {
+                    double* wiersz_i = P + static_cast<size_t>(i) * w;
+                    double l_ic = wiersz_i[kk] / wiersz_c[kk];
+                    wiersz_i[kk] = l_ic;
+                    axpy(w - kk - 1, -l_ic, wiersz_c + kk + 1, wiersz_i + kk + 1);
+                }
+            }
+            zapiszPanel(k, P);
+            wczesniejsze.push_back(k);
+        }
+
+        // zamiany wykonane po rozlozeniu panelu musza jeszcze trafic do jego czesci L
+        wczesniejsze.pop_back();
+        przejdzPanele(wczesniejsze, bufor, zapas, wyprzedzajace_, wczytaj, [&](int j, double* L) {
+            int wj = szerokoscPanelu(j), d1 = poczatekPanelu(j) + wj;
+            for (int r = d1; r < n; r++) {
+                if (zamiany_[r] != r) zamienWiersze(L, wj, r, zamiany_[r]);
+            }
+            zapiszPanel(j, L);
+        });
+    }
+
+    vector<double> RozkladLUPozaPamiecia::solve(const vector<double>& b) const {
+        vector<double> x = b;
+        solve_in_place(x);
+        return x;
+    }
+
+    void RozkladLUPozaPamiecia::solve_in_place(vector<double>& b) const {
+        int n = n_;
+        if (b.size() != n) {
+            throw invalid_argument("Nieprawidłowe wymiary macierzy lub wektora");
+        }
+        for (int i = 0; i < n; i++) {
+            swap(b[i], b[zamiany_[i]]);
+        }
+
+        size_t rozmiarBufora = static_cast<size_t>(n) * szerokosc_;
+        vector<double> bufor(rozmiarBufora), zapas(rozmiarBufora);
+        auto wczytaj = [this](int p, double* cel) { wczytajPanel(p, cel); };
+        vector<int> panele(liczbaPaneli());
+        for (int p = 0; p < liczbaPaneli(); p++) {
+            panele[p] = p;
+        }
+
+        // Ly = Pb kolumnami L, panel po panelu
+        przejdzPanele(panele, bufor, zapas, wyprzedzajace_, wczytaj, [&](int j, double* panel) {
+            int d0 = poczatekPanelu(j), wj = szerokoscPanelu(j);
+            for (int t = d0; t < d0 + wj; t++) {
+                double b_t = b[t];
+                for (int i = t + 1; i < n; i++) {
+                    b[i] -= panel[static_cast<size_t>(i) * wj + (t - d0)] * b_t;
+                }
+            }
+        });
+
+        // Ux = y kolumnami U, od ostatniego panelu
+        reverse(panele.begin(), panele.end());
+        przejdzPanele(panele, bufor, zapas, wyprzedzajace_, wczytaj, [&](int j, double* panel) {
+            int d0 = poczatekPanelu(j), wj = szerokoscPanelu(j);
+            for (int t = d0 + wj - 1; t >= d0; t--) {
+                b[t] /= panel[static_cast<size_t>(t) * wj + (t - d0)];
+                double b_t = b[t];
+                for (int i = 0; i < t; i++) {
+                    b[i] -= panel[static_cast<size_t>(i) * wj + (t - d0)] * b_t;
+                }
+            }
+        });
+    }
+}
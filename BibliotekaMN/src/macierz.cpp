@@ -0,0 +1,95 @@
+//
+// Created by Szymon Ros on 17/10/2026.
+//
+#include "../include/macierz.h"
+#include <algorithm>
+#include <stdexcept>
+
+using namespace std;
+
+namespace biblioteka_numeryczna {
+    // dlugosc wiersza w buforze zaokraglona do 8 double (64 B), zeby kazdy wiersz zaczynal sie na granicy linii cache
+    static int wyrownanyKrok(int kolumny) {
+        return (kolumny + 7) / 8 * 8;
+    }
+
+    Macierz::Macierz() : wiersze_(0), kolumny_(0), krok_(0) {}
+
+    Macierz::Macierz(int wiersze, int kolumny, double wartosc) : wiersze_(0), kolumny_(0), krok_(0) {
+        zmienRozmiar(wiersze, kolumny, wartosc);
+    }
+
+    Macierz::Macierz(const vector<vector<double>>& dane) : wiersze_(0), kolumny_(0), krok_(0) {
+        int w = dane.size();
+        int k = w > 0 ? dane[0].size() : 0;
+        zmienRozmiar(w, k);
+        for (int i = 0; i < w; i++) {
+            if ((int)dane[i].size() != k) {
+                throw invalid_argument("Wszystkie wiersze macierzy muszą mieć tę samą długość");
+            }
+            copy(dane[i].begin(), dane[i].end(), wiersz(i));
+        }
+    }
+
+    Macierz::Macierz(initializer_list<initializer_list<double>> dane) : wiersze_(0), kolumny_(0), krok_(0) {
+        int w = dane.size();
+        int k = w > 0 ? dane.begin()->size() : 0;
+        zmienRozmiar(w, k);
+        int i = 0;
+        for (const auto& wiersz_danych : dane) {
+            if ((int)wiersz_danych.size() != k) {
+                throw invalid_argument("Wszystkie wiersze macierzy muszą mieć tę samą długość");
+            }
+            copy(wiersz_danych.begin(), wiersz_danych.end(), wiersz(i++));
+        }
+    }
+
+    void Macierz::zmienRozmiar(int wiersze, int kolumny, double wartosc) {
+        if (wiersze < 0 || kolumny < 0) {
+            throw invalid_argument("Wymiary macierzy nie mogą być ujemne");
+        }
+        wiersze_ = wiersze;
+        kolumny_ = kolumny;
+        krok_ = wyrownanyKrok(kolumny);
+        bufor_.assign(static_cast<size_t>(wiersze_) * krok_, wartosc);
+    }
+
+    void Macierz::zamienWiersze(int a, int b) {
+        if (a == b) {
+            return;
+        }
+        swap_ranges(wiersz(a), wiersz(a) + kolumny_, wiersz(b));
+    }
+
+    vector<vector<double>> Macierz::doWektorow() const {
+        vector<vector<double>> wynik(wiersze_);
+        for (int i = 0; i < wiersze_; i++) {
+            wynik[i].assign(wiersz(i), wiersz(i) + kolumny_);
+        }
+        return wynik;
+    }
+
+    Macierz Macierz::jednostkowa(int n) {
+        Macierz I(n, n);
+        for (int i = 0; i < n; i++) {
+            I(i, i) = 1.0;
+        }
+        return I;
+    }
+
+    vector<double> pomnoz(const Macierz& A, const vector<double>& x) {
+        if ((int)x.size() != A.kolumny()) {
+            throw invalid_argument("Nieprawidłowe wymiary macierzy lub wektora");
+        }
+        vector<double> y(A.wiersze(), 0.0);
+        for (int i = 0; i < A.wiersze(); i++) {
+            const double* a = A.wiersz(i);
+            double suma = 0.0;
+            for (int j = 0; j < A.kolumny(); j++) {
+                suma += a[j] * x[j];
+            }
+            y[i] = suma;
+        }
+        return y;
+    }
+}
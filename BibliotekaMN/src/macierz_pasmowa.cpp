@@ -0,0 +1,77 @@
+//
+// Created by Szymon Ros on 17/10/2026.
+//
+#include "../include/macierz_pasmowa.h"
+#include <algorithm>
+#include <stdexcept>
+
+using namespace std;
+
+namespace biblioteka_numeryczna {
+    MacierzPasmowa::MacierzPasmowa() : rozmiar_(0), dolna_(0), gorna_(0), szerokosc_(1) {}
+
+    MacierzPasmowa::MacierzPasmowa(int rozmiar, int dolna, int gorna)
+        : rozmiar_(rozmiar), dolna_(dolna), gorna_(gorna), szerokosc_(2 * dolna + gorna + 1) {
+        if (rozmiar < 0 || dolna < 0 || gorna < 0) {
+            throw invalid_argument("Wymiar i szerokości pasma nie mogą być ujemne");
+        }
+        dane_.assign(static_cast<size_t>(rozmiar_) * szerokosc_, 0.0);
+    }
+
+    MacierzPasmowa MacierzPasmowa::zGestej(const Macierz& A) {
+        if (A.wiersze() != A.kolumny()) {
+            throw invalid_argument("Macierz musi być kwadratowa");
+        }
+        int n = A.wiersze();
+        int dolna = 0, gorna = 0;
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < n; j++) {
+                if (A(i, j) != 0.0) {
+                    dolna = max(dolna, i - j);
+                    gorna = max(gorna, j - i);
+                }
+            }
+        }
+
+        MacierzPasmowa wynik(n, dolna, gorna);
+        for (int i = 0; i < n; i++) {
+            for (int j = max(0, i - dolna); j <= min(n - 1, i + gorna); j++) {
+                wynik(i, j) = A(i, j);
+            }
+        }
+        return wynik;
+    }
+
+    double MacierzPasmowa::element(int i, int j) const {
+        if (i < 0 || i >= rozmiar_ || j < 0 || j >= rozmiar_) {
+            throw out_of_range("Indeks poza wymiarami macierzy");
+        }
+        return wPasmie(i, j) ? (*this)(i, j) : 0.0;
+    }
+
+    Macierz MacierzPasmowa::doGestej() const {
+        Macierz wynik(rozmiar_, rozmiar_);
+        for (int i = 0; i < rozmiar_; i++) {
+            for (int j = max(0, i - dolna_); j <= min(rozmiar_ - 1, i + gorna_); j++) {
+                wynik(i, j) = (*this)(i, j);
+            }
+        }
+        return wynik;
+    }
+
+    vector<double> pomnoz(const MacierzPasmowa& A, const vector<double>& x) {
+        int n = A.rozmiar();
+        if ((int)x.size() != n) {
+            throw invalid_argument("Nieprawidłowe wymiary macierzy lub wektora");
+        }
+        vector<double> y(n);
+        for (int i = 0; i < n; i++) {
+            double suma = 0.0;
+            for (int j = max(0, i - A.dolna()); j <= min(n - 1, i + A.gorna()); j++) {
+                suma += A(i, j) * x[j];
+            }
+            y[i] = suma;
+        }
+        return y;
+    }
+}
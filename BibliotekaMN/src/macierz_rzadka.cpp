@@ -0,0 +1,561 @@
+//
+// Created by Szymon Ros on 17/10/2026.
+//
+#include "../include/macierz_rzadka.h"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <set>
+#include <tuple>
+#include <stdexcept>
+
+using namespace std;
+
+namespace biblioteka_numeryczna {
+    MacierzRzadkaCSR::MacierzRzadkaCSR() : wiersze_(0), kolumny_(0), poczatkiWierszy_(1, 0) {}
+
+    MacierzRzadkaCSR::MacierzRzadkaCSR(int wiersze, int kolumny,
+                                       vector<int> poczatkiWierszy,
+                                       vector<int> indeksyKolumn,
+                                       vector<double> wartosci)
+        : wiersze_(wiersze), kolumny_(kolumny),
+          poczatkiWierszy_(move(poczatkiWierszy)),
+          indeksyKolumn_(move(indeksyKolumn)),
+          wartosci_(move(wartosci)) {
+        if (wiersze_ < 0 || kolumny_ < 0 || poczatkiWierszy_.size() != wiersze_ + 1 ||
+            indeksyKolumn_.size() != wartosci_.size() || poczatkiWierszy_[0] != 0 ||
+            poczatkiWierszy_[wiersze_] != (int)wartosci_.size()) {
+            throw invalid_argument("Niespójne tablice macierzy CSR");
+        }
+        for (int i = 0; i < wiersze_; i++) {
+            if (poczatkiWierszy_[i] > poczatkiWierszy_[i + 1]) {
+                throw invalid_argument("Niespójne tablice macierzy CSR");
+            }
+            for (int p = poczatkiWierszy_[i]; p < poczatkiWierszy_[i + 1]; p++) {
+                if (indeksyKolumn_[p] < 0 || indeksyKolumn_[p] >= kolumny_ ||
+                    (p > poczatkiWierszy_[i] && indeksyKolumn_[p] <= indeksyKolumn_[p - 1])) {
+                    throw invalid_argument("Kolumny w wierszu macierzy CSR muszą być rosnące i w zakresie");
+                }
+            }
+        }
+    }
+
+    MacierzRzadkaCSR MacierzRzadkaCSR::zTrojek(int wiersze, int kolumny, vector<Trojka> trojki) {
+        for (const Trojka& t : trojki) {
+            if (t.wiersz < 0 || t.wiersz >= wiersze || t.kolumna < 0 || t.kolumna >= kolumny) {
+                throw invalid_argument("Trójka poza wymiarami macierzy");
+            }
+        }
+        sort(trojki.begin(), trojki.end(), [](const Trojka& a, const Trojka& b) {
+            return a.wiersz != b.wiersz ? a.wiersz < b.wiersz : a.kolumna < b.kolumna;
+        });
+
+        vector<int> poczatki(wiersze + 1, 0);
+        vector<int> kolumnyCSR;
+        vector<double> wartosci;
+        kolumnyCSR.reserve(trojki.size());
+        wartosci.reserve(trojki.size());
+
+        for (size_t p = 0; p < trojki.size(); p++) {
+            const Trojka& t = trojki[p];
+            if (p > 0 && trojki[p - 1].wiersz == t.wiersz && trojki[p - 1].kolumna == t.kolumna) {
+                wartosci.back() += t.wartosc;       // powtorzona pozycja - sumujemy
+                continue;
+            }
+            kolumnyCSR.push_back(t.kolumna);
+            wartosci.push_back(t.wartosc);
+            poczatki[t.wiersz + 1]++;
+        }
+        for (int i = 0; i < wiersze; i++) {
+            poczatki[i + 1] += poczatki[i];
+        }
+
+        return MacierzRzadkaCSR(wiersze, kolumny, move(poczatki), move(kolumnyCSR), move(wartosci));
+    }
+
+    MacierzRzadkaCSR MacierzRzadkaCSR::zGestej(const Macierz& A, double prog) {
+        vector<int> poczatki(A.wiersze() + 1, 0);
+        vector<int> kolumnyCSR;
+        vector<double> wartosci;
+
+        for (int i = 0; i < A.wiersze(); i++) {
+            const double* wiersz_i = A.wiersz(i);
+            for (int j = 0; j < A.kolumny(); j++) {
+                if (fabs(wiersz_i[j]) > prog) {
+                    kolumnyCSR.push_back(j);
+                    wartosci.push_back(wiersz_i[j]);
+                }
+            }
+            poczatki[i + 1] = wartosci.size();
+        }
+
+        return MacierzRzadkaCSR(A.wiersze(), A.kolumny(), move(poczatki), move(kolumnyCSR), move(wartosci));
+    }
+
+    MacierzRzadkaCSR MacierzRzadkaCSR::zGestej(const vector<vector<double>>& A, double prog) {
+        return zGestej(Macierz(A), prog);
+    }
+
+    double MacierzRzadkaCSR::element(int i, int j) const {
+        auto poczatek = indeksyKolumn_.begin() + poczatkiWierszy_[i];
+        auto koniec = indeksyKolumn_.begin() + poczatkiWierszy_[i + 1];
+        auto it = lower_bound(poczatek, koniec, j);
+        if (it != koniec && *it == j) {
+            return wartosci_[it - indeksyKolumn_.begin()];
+        }
+        return 0.0;
+    }
+
+    vector<int> MacierzRzadkaCSR::indeksyPrzekatnej() const {
+        vector<int> przekatna(min(wiersze_, kolumny_), -1);
+        for (int i = 0; i < (int)przekatna.size(); i++) {
+            for (int p = poczatkiWierszy_[i]; p < poczatkiWierszy_[i + 1]; p++) {
+                if (indeksyKolumn_[p] == i) {
+                    przekatna[i] = p;
+                    break;
+                }
+            }
+        }
+        return przekatna;
+    }
+
+    Macierz MacierzRzadkaCSR::doGestej() const {
+        Macierz A(wiersze_, kolumny_);
+        for (int i = 0; i < wiersze_; i++) {
+            for (int p = poczatkiWierszy_[i]; p < poczatkiWierszy_[i + 1]; p++) {
+                A(i, indeksyKolumn_[p]) = wartosci_[p];
+            }
+        }
+        return A;
+    }
+
+    vector<double> pomnoz(const MacierzRzadkaCSR& A, const vector<double>& x) {
+        if ((int)x.size() != A.kolumny()) {
+            throw invalid_argument("Nieprawidłowe wymiary macierzy lub wektora");
+        }
+        const vector<int>& poczatki = A.poczatkiWierszy();
+        const vector<int>& kolumny = A.indeksyKolumn();
+        const vector<double>& wartosci = A.wartosci();
+
+        vector<double> y(A.wiersze());
+        for (int i = 0; i < A.wiersze(); i++) {
+            double suma = 0.0;
+            for (int p = poczatki[i]; p < poczatki[i + 1]; p++) {
+                suma += wartosci[p] * x[kolumny[p]];
+            }
+            y[i] = suma;
+        }
+        return y;
+    }
+
+    vector<int> kolorowanieZachlanne(const MacierzRzadkaCSR& A) {
+        if (A.wiersze() != A.kolumny()) {
+            throw invalid_argument("Macierz musi być kwadratowa");
+        }
+        int n = A.wiersze();
+        const vector<int>& poczatki = A.poczatkiWierszy();
+        const vector<int>& kolumny = A.indeksyKolumn();
+
+        // sasiedztwo symetryczne: wiersz i widzi kolumny wiersza i oraz wiersze majace i w kolumnach (A^T)
+        vector<int> poczatkiT(n + 1, 0);
+        for (int j : kolumny) {
+            poczatkiT[j + 1]++;
+        }
+        for (int i = 0; i < n; i++) {
+            poczatkiT[i + 1] += poczatkiT[i];
+        }
+        vector<int> wierszeT(kolumny.size());
+        vector<int> pozycja(poczatkiT.begin(), poczatkiT.end() - 1);
+        for (int i = 0; i < n; i++) {
+            for (int p = poczatki[i]; p < poczatki[i + 1]; p++) {
+                wierszeT[pozycja[kolumny[p]]++] = i;
+            }
+        }
+
+        vector<int> kolory(n, -1);
+        vector<int> zajetyPrzez;      // zajetyPrzez[c] == i oznacza, ze kolor c ma sasiad wiersza i
+        for (int i = 0; i < n; i++) {
+            auto zaznacz = [&](int j) {
+                if (j != i && kolory[j] >= 0) {
+                    if (kolory[j] >= (int)zajetyPrzez.size()) {
+                        zajetyPrzez.resize(kolory[j] + 1, -1);
+                    }
+                    zajetyPrzez[kolory[j]] = i;
+                }
+            };
+            for (int p = poczatki[i]; p < poczatki[i + 1]; p++) {
+                zaznacz(kolumny[p]);
+            }
+            for (int p = poczatkiT[i]; p < poczatkiT[i + 1]; p++) {
+                zaznacz(wierszeT[p]);
+            }
+            int kolor = 0;
+            while (kolor < (int)zajetyPrzez.size() && zajetyPrzez[kolor] == i) {
+                kolor++;
+            }
+            kolory[i] = kolor;
+        }
+        return kolory;
+    }
+
+    vector<int> kolorowanieCzerwonoCzarne(int nx, int ny, int nz) {
+        if (nx <= 0 || ny <= 0 || nz <= 0) {
+            throw invalid_argument("Wymiary siatki muszą być dodatnie");
+        }
+        vector<int> kolory(static_cast<size_t>(nx) * ny * nz);
+        size_t i = 0;
+        for (int z = 0; z < nz; z++) {
+            for (int y = 0; y < ny; y++) {
+                for (int x = 0; x < nx; x++) {
+                    kolory[i++] = (x + y + z) % 2;
+                }
+            }
+        }
+        return kolory;
+    }
+
+    bool poprawneKolorowanie(const MacierzRzadkaCSR& A, const vector<int>& kolory) {
+        if ((int)kolory.size() != A.wiersze() || A.wiersze() != A.kolumny()) {
+            return false;
+        }
+        const vector<int>& poczatki = A.poczatkiWierszy();
+        const vector<int>& kolumny = A.indeksyKolumn();
+        for (int i = 0; i < A.wiersze(); i++) {
+            if (kolory[i] < 0) {
+                return false;
+            }
+            for (int p = poczatki[i]; p < poczatki[i + 1]; p++) {
+                if (kolumny[p] != i && kolory[kolumny[p]] == kolory[i]) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    void grafSymetryczny(const MacierzRzadkaCSR& A, vector<int>& poczatki, vector<int>& sasiedzi) {
+        if (A.wiersze() != A.kolumny()) {
+            throw invalid_argument("Macierz musi być kwadratowa");
+        }
+        int n = A.wiersze();
+        const vector<int>& poczatkiA = A.poczatkiWierszy();
+        const vector<int>& kolumny = A.indeksyKolumn();
+
+        // kazda krawedz (i, j) zapisana w obu kierunkach, potem sortowanie i usuniecie powtorzen
+        poczatki.assign(n + 1, 0);
+        for (int i = 0; i < n; i++) {
+            for (int p = poczatkiA[i]; p < poczatkiA[i + 1]; p++) {
+                if (kolumny[p] != i) {
+                    poczatki[i + 1]++;
+                    poczatki[kolumny[p] + 1]++;
+                }
+            }
+        }
+        for (int i = 0; i < n; i++) {
+            poczatki[i + 1] += poczatki[i];
+        }
+        vector<int> wszyscy(poczatki[n]);
+        vector<int> pozycja(poczatki.begin(), poczatki.end() - 1);
+        for (int i = 0; i < n; i++) {
+            for (int p = poczatkiA[i]; p < poczatkiA[i + 1]; p++) {
+                int j = kolumny[p];
+                if (j != i) {
+                    wszyscy[pozycja[i]++] = j;
+                    wszyscy[pozycja[j]++] = i;
+                }
+            }
+        }
+
+        sasiedzi.clear();
+        sasiedzi.reserve(wszyscy.size());
+        int poczatek = 0;
+        for (int i = 0; i < n; i++) {
+            auto od = wszyscy.begin() + poczatki[i];
+            auto doKonca = wszyscy.begin() + poczatki[i + 1];
+            sort(od, doKonca);
+            sasiedzi.insert(sasiedzi.end(), od, unique(od, doKonca));
+            poczatki[i] = poczatek;
+            poczatek = sasiedzi.size();
+        }
+        poczatki[n] = poczatek;
+    }
+
+    // przeszukiwanie wszerz ograniczone do wierzcholkow z grupa[v] == id; odwiedzone dostaja znacznik[v] = znak,
+    // kolejnosc to wierzcholki w kolejnosci odwiedzin, poziomy[l] to poczatek poziomu l w kolejnosc
+    static void strukturaPoziomow(const vector<int>& poczatki, const vector<int>& sasiedzi, int start,
+                                  const vector<int>& grupa, int id, vector<int>& znacznik, int znak,
+                                  vector<int>& kolejnosc, vector<int>& poziomy) {
+        kolejnosc.clear();
+        poziomy.clear();
+        kolejnosc.push_back(start);
+        znacznik[start] = znak;
+        size_t poczatekPoziomu = 0;
+        while (poczatekPoziomu < kolejnosc.size()) {
+            poziomy.push_back(poczatekPoziomu);
+            size_t koniecPoziomu = kolejnosc.size();
+            for (size_t t = poczatekPoziomu; t < koniecPoziomu; t++) {
+                int v = kolejnosc[t];
+                for (int p = poczatki[v]; p < poczatki[v + 1]; p++) {
+                    int w = sasiedzi[p];
+                    if (grupa[w] == id && znacznik[w] != znak) {
+                        znacznik[w] = znak;
+                        kolejnosc.push_back(w);
+                    }
+                }
+            }
+            poczatekPoziomu = koniecPoziomu;
+        }
+        poziomy.push_back(kolejnosc.size());
+    }
+
+    // wierzcholek pseudoperyferyjny (Gibbs, Poole, Stockmeyer): start przesuwany do wierzcholka o najmniejszym
+    // stopniu na ostatnim poziomie, dopoki liczba poziomow rosnie
+    static int wierzcholekPseudoperyferyjny(const vector<int>& poczatki, const vector<int>& sasiedzi, int start,
+                                            const vector<int>& grupa, int id, vector<int>& znacznik, int& znak) {
+        vector<int> kolejnosc, poziomy;
+        strukturaPoziomow(poczatki, sasiedzi, start, grupa, id, znacznik, ++znak, kolejnosc, poziomy);
+        for (int iteracja = 0; iteracja < 8; iteracja++) {
+            int glebokosc = poziomy.size();
+            int kandydat = kolejnosc[poziomy[glebokosc - 2]];
+            for (int t = poziomy[glebokosc - 2]; t < poziomy[glebokosc - 1]; t++) {
+                int v = kolejnosc[t];
+                if (poczatki[v + 1] - poczatki[v] < poczatki[kandydat + 1] - poczatki[kandydat]) {
+                    kandydat = v;
+                }
+            }
+            strukturaPoziomow(poczatki, sasiedzi, kandydat, grupa, id, znacznik, ++znak, kolejnosc, poziomy);
+            if ((int)poziomy.size() <= glebokosc) {
+                break;
+            }
+            start = kandydat;
+        }
+        return start;
+    }
+
+    vector<int> uporzadkowanieMinimalnegoStopnia(const MacierzRzadkaCSR& A) {
+        vector<int> poczatki, sasiedzi;
+        grafSymetryczny(A, poczatki, sasiedzi);
+        int n = A.wiersze();
+
+        // graf ilorazowy: zmienne[v] - sasiedzi v, ktorzy sa jeszcze zmiennymi; elementy[v] - elementy przy v;
+        // element e (wyeliminowany wierzcholek) to klika czlonkowie[e]
+        vector<vector<int>> zmienne(n), elementy(n), czlonkowie(n);
+        for (int v = 0; v < n; v++) {
+            zmienne[v].assign(sasiedzi.begin() + poczatki[v], sasiedzi.begin() + poczatki[v + 1]);
+        }
+        vector<char> wyeliminowany(n, 0), wchloniety(n, 0), wNowymElemencie(n, 0);
+        vector<int> znacznik(n, 0);
+        int znak = 0;
+
+        // stopien zewnetrzny: liczba roznych zmiennych osiagalnych przez sasiadow i elementy
+        auto stopien = [&](int v) {
+            znacznik[v] = ++znak;
+            int d = 0;
+            for (int w : zmienne[v]) {
+                if (znacznik[w] != znak) {
+                    znacznik[w] = znak;
+                    d++;
+                }
+            }
+            for (int e : elementy[v]) {
+                for (int w : czlonkowie[e]) {
+                    if (znacznik[w] != znak) {
+                        znacznik[w] = znak;
+                        d++;
+                    }
+                }
+            }
+            return d;
+        };
+
+        // przy rownych stopniach najpierw ostatnio aktualizowany (jak listy stopni w AMD)
+        vector<int> stopnie(n), wiek(n);
+        int zegar = 0;
+        set<tuple<int, int, int>> kolejka;
+        for (int v = 0; v < n; v++) {
+            stopnie[v] = poczatki[v + 1] - poczatki[v];
+            wiek[v] = zegar--;
+            kolejka.insert({stopnie[v], wiek[v], v});
+        }
+
+        vector<int> permutacja;
+        permutacja.reserve(n);
+        while (!kolejka.empty()) {
+            int p = get<2>(*kolejka.begin());
+            kolejka.erase(kolejka.begin());
+            wyeliminowany[p] = 1;
+            permutacja.push_back(p);
+
+            // nowy element: zmienne sasiadujace z p bezposrednio lub przez elementy, ktore p wchlania
+            vector<int> nowy;
+            for (int w : zmienne[p]) {
+                if (!wNowymElemencie[w]) {
+                    wNowymElemencie[w] = 1;
+                    nowy.push_back(w);
+                }
+            }
+            for (int e : elementy[p]) {
+                for (int w : czlonkowie[e]) {
+                    if (w != p && !wNowymElemencie[w]) {
+                        wNowymElemencie[w] = 1;
+                        nowy.push_back(w);
+                    }
+                }
+                wchloniety[e] = 1;
+                vector<int>().swap(czlonkowie[e]);
+            }
+            vector<int>().swap(zmienne[p]);
+            vector<int>().swap(elementy[p]);
+
+            for (int v : nowy) {
+                auto& el = elementy[v];
+                el.erase(remove_if(el.begin(), el.end(), [&](int e) { return wchloniety[e] != 0; }), el.end());
+                el.push_back(p);
+                // sasiedztwo z innymi czlonkami nowego elementu jest juz zapisane w elemencie p
+                auto& zm = zmienne[v];
+                zm.erase(remove_if(zm.begin(), zm.end(),
+                                   [&](int w) { return wyeliminowany[w] || wNowymElemencie[w]; }), zm.end());
+            }
+            for (int v : nowy) {
+                wNowymElemencie[v] = 0;
+            }
+            czlonkowie[p] = move(nowy);
+            for (int v : czlonkowie[p]) {
+                kolejka.erase({stopnie[v], wiek[v], v});
+                stopnie[v] = stopien(v);
+                wiek[v] = zegar--;
+                kolejka.insert({stopnie[v], wiek[v], v});
+            }
+        }
+        return permutacja;
+    }
+
+    vector<int> uporzadkowanieOdwrotneCuthillaMcKee(const MacierzRzadkaCSR& A) {
+        vector<int> poczatki, sasiedzi;
+        grafSymetryczny(A, poczatki, sasiedzi);
+        int n = A.wiersze();
+        auto stopien = [&](int v) { return poczatki[v + 1] - poczatki[v]; };
+
+        vector<int> grupa(n, 0), znacznik(n, 0);
+        int znak = 0;
+        vector<char> odwiedzony(n, 0);
+        vector<int> permutacja;
+        permutacja.reserve(n);
+        vector<int> kandydaci;
+        for (int v = 0; v < n; v++) {
+            if (odwiedzony[v]) {
+                continue;
+            }
+            int start = wierzcholekPseudoperyferyjny(poczatki, sasiedzi, v, grupa, 0, znacznik, znak);
+            size_t glowa = permutacja.size();
+            permutacja.push_back(start);
+            odwiedzony[start] = 1;
+            while (glowa < permutacja.size()) {
+                int u = permutacja[glowa++];
+                kandydaci.clear();
+                for (int p = poczatki[u]; p < poczatki[u + 1]; p++) {
+                    if (!odwiedzony[sasiedzi[p]]) {
+                        odwiedzony[sasiedzi[p]] = 1;
+                        kandydaci.push_back(sasiedzi[p]);
+                    }
+                }
+                stable_sort(kandydaci.begin(), kandydaci.end(), [&](int a, int b) { return stopien(a) < stopien(b); });
+                permutacja.insert(permutacja.end(), kandydaci.begin(), kandydaci.end());
+            }
+        }
+        reverse(permutacja.begin(), permutacja.end());
+        return permutacja;
+    }
+
+    vector<int> uporzadkowaniePodzialuZagniezdzonego(const MacierzRzadkaCSR& A, int minimalnyRozmiar) {
+        if (minimalnyRozmiar < 1) {
+            throw invalid_argument("Minimalny rozmiar części musi być dodatni");
+        }
+        vector<int> poczatki, sasiedzi;
+        grafSymetryczny(A, poczatki, sasiedzi);
+        int n = A.wiersze();
+
+        vector<int> grupa(n, 0), znacznik(n, 0);
+        int znak = 0, ostatniaGrupa = 0;
+        vector<int> permutacja;
+        permutacja.reserve(n);
+        vector<int> kolejnosc, poziomy;
+
+        function<void(vector<int>)> podziel = [&](vector<int> wezly) {
+            if ((int)wezly.size() <= minimalnyRozmiar) {
+                permutacja.insert(permutacja.end(), wezly.begin(), wezly.end());
+                return;
+            }
+            int id = ++ostatniaGrupa;
+            for (int v : wezly) {
+                grupa[v] = id;
+            }
+
+            int start = wierzcholekPseudoperyferyjny(poczatki, sasiedzi, wezly[0], grupa, id, znacznik, znak);
+            strukturaPoziomow(poczatki, sasiedzi, start, grupa, id, znacznik, ++znak, kolejnosc, poziomy);
+
+            if (kolejnosc.size() < wezly.size()) {
+                // graf niespojny: kazda skladowa porzadkowana osobno, bez separatora
+                vector<vector<int>> skladowe = {kolejnosc};
+                int znakPierwszej = znak;
+                int znakPozostalych = ++znak;
+                for (int v : wezly) {
+                    if (znacznik[v] != znakPierwszej && znacznik[v] != znakPozostalych) {
+                        strukturaPoziomow(poczatki, sasiedzi, v, grupa, id, znacznik, znakPozostalych, kolejnosc, poziomy);
+                        skladowe.push_back(kolejnosc);
+                    }
+                }
+                for (auto& skladowa : skladowe) {
+                    podziel(move(skladowa));
+                }
+                return;
+            }
+
+            int liczbaPoziomow = poziomy.size() - 1;
+            if (liczbaPoziomow < 3) {
+                permutacja.insert(permutacja.end(), wezly.begin(), wezly.end());
+                return;
+            }
+            // separator: poziom, na ktorym przekraczana jest polowa wierzcholkow (krawedzie lacza tylko sasiednie poziomy)
+            int m = 1;
+            while (m < liczbaPoziomow - 2 && poziomy[m + 1] < (int)wezly.size() / 2) {
+                m++;
+            }
+            vector<int> czesc1(kolejnosc.begin(), kolejnosc.begin() + poziomy[m]);
+            vector<int> separator(kolejnosc.begin() + poziomy[m], kolejnosc.begin() + poziomy[m + 1]);
+            vector<int> czesc2(kolejnosc.begin() + poziomy[m + 1], kolejnosc.end());
+            podziel(move(czesc1));
+            podziel(move(czesc2));
+            permutacja.insert(permutacja.end(), separator.begin(), separator.end());
+        };
+
+        vector<int> wszystkie(n);
+        for (int v = 0; v < n; v++) {
+            wszystkie[v] = v;
+        }
+        podziel(move(wszystkie));
+        return permutacja;
+    }
+
+    vector<int> wyznaczUporzadkowanie(const MacierzRzadkaCSR& A, Uporzadkowanie rodzaj) {
+        switch (rodzaj) {
+            case Uporzadkowanie::MinimalnyStopien:
+                return uporzadkowanieMinimalnegoStopnia(A);
+            case Uporzadkowanie::OdwrotneCuthillaMcKee:
+                return uporzadkowanieOdwrotneCuthillaMcKee(A);
+            case Uporzadkowanie::PodzialZagniezdzony:
+                return uporzadkowaniePodzialuZagniezdzonego(A);
+            case Uporzadkowanie::Naturalne:
+            default: {
+                if (A.wiersze() != A.kolumny()) {
+                    throw invalid_argument("Macierz musi być kwadratowa");
+                }
+                vector<int> permutacja(A.wiersze());
+                for (int i = 0; i < A.wiersze(); i++) {
+                    permutacja[i] = i;
+                }
+                return permutacja;
+            }
+        }
+    }
+}
@@ -0,0 +1,156 @@
+//
+// Created by Szymon Ros on 17/10/2026.
+//
+#include "../include/pamiec_rozkladow.h"
+#include <atomic>
+#include <cstring>
+
+using namespace std;
+
+namespace biblioteka_numeryczna {
+    static uint64_t obrot(uint64_t x, int r) {
+        return (x << r) | (x >> (64 - r));
+    }
+
+    // koncowe mieszanie z MurmurHash3
+    static uint64_t wymieszaj(uint64_t h) {
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ULL;
+        h ^= h >> 33;
+        return h;
+    }
+
+    SkrotMacierzy SkrotMacierzy::oblicz(const Macierz& A) {
+        // h1: FNV-1a po 64-bitowych slowach, h2: runda MurmurHash3; pomijane sa komorki dopelnienia wiersza
+        uint64_t h1 = 0xcbf29ce484222325ULL;
+        uint64_t h2 = 0x9e3779b97f4a7c15ULL;
+        auto dodaj = [&](uint64_t slowo) {
+            h1 = (h1 ^ slowo) * 0x100000001b3ULL;
+            uint64_t k = obrot(slowo * 0x87c37b91114253d5ULL, 31) * 0x4cf5ad432745937fULL;
+            h2 = obrot(h2 ^ k, 27) * 5 + 0x52dce729;
+        };
+        dodaj(static_cast<uint64_t>(A.wiersze()));
+        dodaj(static_cast<uint64_t>(A.kolumny()));
+        for (int i = 0; i < A.wiersze(); i++) {
+            const double* wiersz = A.wiersz(i);
+            for (int j = 0; j < A.kolumny(); j++) {
+                uint64_t bity;
+                memcpy(&bity, wiersz + j, sizeof(bity));
+                dodaj(bity);
+            }
+        }
+        return {wymieszaj(h1), wymieszaj(h2)};
+    }
+
+    PamiecRozkladow::PamiecRozkladow(size_t limitBajtow) : limit_(limitBajtow) {}
+
+    shared_ptr<const RozkladLU> PamiecRozkladow::rozklad(const Macierz& A) {
+        SkrotMacierzy skrot = SkrotMacierzy::oblicz(A);
+        {
+            lock_guard<mutex> blokada(blokada_);
+            auto it = indeks_.find(skrot);
+            if (it != indeks_.end()) {
+                trafienia_++;
+                kolejnosc_.splice(kolejnosc_.begin(), kolejnosc_, it->second);
+                return it->second->rozklad;
+            }
+            chybienia_++;
+        }
+
+        // rozklad poza blokada, zeby inne watki mogly w tym czasie korzystac z pamieci
+        shared_ptr<const RozkladLU> nowy = make_shared<const RozkladLU>(A);
+        size_t bajty = sizeof(RozkladLU) + sizeof(double) * nowy->macierzLU().wiersze() * nowy->macierzLU().krok() +
+                       2 * sizeof(int) * nowy->rozmiar();
+
+        lock_guard<mutex> blokada(blokada_);
+        auto it = indeks_.find(skrot);
+        if (it != indeks_.end()) {
+            return it->second->rozklad;     // ten sam rozkład dodał w międzyczasie inny wątek
+        }
+        if (bajty <= limit_) {
+            kolejnosc_.push_front({skrot, nowy, bajty});
+            indeks_[skrot] = kolejnosc_.begin();
+            zajete_ += bajty;
+            ograniczDoLimitu();
+        }
+        return nowy;
+    }
+
+    bool PamiecRozkladow::uniewaznij(const Macierz& A) {
+        SkrotMacierzy skrot = SkrotMacierzy::oblicz(A);
+        lock_guard<mutex> blokada(blokada_);
+        auto it = indeks_.find(skrot);
+        if (it == indeks_.end()) {
+            return false;
+        }
+        zajete_ -= it->second->bajty;
+        kolejnosc_.erase(it->second);
+        indeks_.erase(it);
+        return true;
+    }
+
+    void PamiecRozkladow::wyczysc() {
+        lock_guard<mutex> blokada(blokada_);
+        kolejnosc_.clear();
+        indeks_.clear();
+        zajete_ = 0;
+    }
+
+    void PamiecRozkladow::ustawLimit(size_t limitBajtow) {
+        lock_guard<mutex> blokada(blokada_);
+        limit_ = limitBajtow;
+        ograniczDoLimitu();
+    }
+
+    void PamiecRozkladow::ograniczDoLimitu() {
+        while (zajete_ > limit_ && !kolejnosc_.empty()) {
+            const Wpis& najstarszy = kolejnosc_.back();
+            zajete_ -= najstarszy.bajty;
+            indeks_.erase(najstarszy.skrot);
+            kolejnosc_.pop_back();
+            usuniete_++;
+        }
+    }
+
+    size_t PamiecRozkladow::limit() const {
+        lock_guard<mutex> blokada(blokada_);
+        return limit_;
+    }
+
+    size_t PamiecRozkladow::zajetaPamiec() const {
+        lock_guard<mutex> blokada(blokada_);
+        return zajete_;
+    }
+
+    size_t PamiecRozkladow::liczbaRozkladow() const {
+        lock_guard<mutex> blokada(blokada_);
+        return kolejnosc_.size();
+    }
+
+    size_t PamiecRozkladow::trafienia() const {
+        lock_guard<mutex> blokada(blokada_);
+        return trafienia_;
+    }
+
+    size_t PamiecRozkladow::chybienia() const {
+        lock_guard<mutex> blokada(blokada_);
+        return chybienia_;
+    }
+
+    size_t PamiecRozkladow::usuniete() const {
+        lock_guard<mutex> blokada(blokada_);
+        return usuniete_;
+    }
+
+    static atomic<PamiecRozkladow*> aktywnaPamiec{nullptr};
+
+    PamiecRozkladow* ustawPamiecRozkladow(PamiecRozkladow* pamiec) {
+        return aktywnaPamiec.exchange(pamiec);
+    }
+
+    PamiecRozkladow* pamiecRozkladow() {
+        return aktywnaPamiec.load(memory_order_acquire);
+    }
+}
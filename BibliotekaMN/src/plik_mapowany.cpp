@@ -0,0 +1,99 @@
+//
+// Created by Szymon Ros on 17/10/2026.
+//
+#include "../include/plik_mapowany.h"
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define BIBLIOTEKA_MN_MMAP 1
+#endif
+
+using namespace std;
+
+namespace biblioteka_numeryczna {
+    PlikMapowany::PlikMapowany(const string& sciezka) : sciezka_(sciezka) {
+#ifdef BIBLIOTEKA_MN_MMAP
+        int fd = open(sciezka.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw runtime_error("Nie można otworzyć pliku: " + sciezka);
+        }
+        struct stat info;
+        if (fstat(fd, &info) != 0) {
+            close(fd);
+            throw runtime_error("Nie można odczytać rozmiaru pliku: " + sciezka);
+        }
+        rozmiar_ = info.st_size;
+        if (rozmiar_ > 0) {
+            void* p = mmap(nullptr, rozmiar_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (p == MAP_FAILED) {
+                close(fd);
+                throw runtime_error("Nie można zmapować pliku: " + sciezka);
+            }
+            madvise(p, rozmiar_, MADV_SEQUENTIAL);
+            dane_ = static_cast<const char*>(p);
+            zmapowany_ = true;
+        }
+        close(fd);          // mapowanie pozostaje ważne po zamknięciu deskryptora
+#else
+        ifstream plik(sciezka, ios::binary | ios::ate);
+        if (!plik) {
+            throw runtime_error("Nie można otworzyć pliku: " + sciezka);
+        }
+        bufor_.resize(static_cast<size_t>(plik.tellg()));
+        plik.seekg(0);
+        plik.read(bufor_.data(), bufor_.size());
+        dane_ = bufor_.data();
+        rozmiar_ = bufor_.size();
+#endif
+    }
+
+    PlikMapowany::~PlikMapowany() {
+        zwolnij();
+    }
+
+    PlikMapowany::PlikMapowany(PlikMapowany&& inny) noexcept
+        : sciezka_(move(inny.sciezka_)), dane_(inny.dane_), rozmiar_(inny.rozmiar_),
+          zmapowany_(inny.zmapowany_), bufor_(move(inny.bufor_)) {
+        if (!zmapowany_ && !bufor_.empty()) {
+            dane_ = bufor_.data();
+        }
+        inny.dane_ = nullptr;
+        inny.rozmiar_ = 0;
+        inny.zmapowany_ = false;
+    }
+
+    PlikMapowany& PlikMapowany::operator=(PlikMapowany&& inny) noexcept {
+        if (this != &inny) {
+            zwolnij();
+            sciezka_ = move(inny.sciezka_);
+            dane_ = inny.dane_;
+            rozmiar_ = inny.rozmiar_;
+            zmapowany_ = inny.zmapowany_;
+            bufor_ = move(inny.bufor_);
+            if (!zmapowany_ && !bufor_.empty()) {
+                dane_ = bufor_.data();
+            }
+            inny.dane_ = nullptr;
+            inny.rozmiar_ = 0;
+            inny.zmapowany_ = false;
+        }
+        return *this;
+    }
+
+    void PlikMapowany::zwolnij() noexcept {
+#ifdef BIBLIOTEKA_MN_MMAP
+        if (zmapowany_) {
+            munmap(const_cast<char*>(dane_), rozmiar_);
+        }
+#endif
+        dane_ = nullptr;
+        rozmiar_ = 0;
+        zmapowany_ = false;
+    }
+}
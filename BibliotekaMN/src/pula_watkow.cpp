@@ -0,0 +1,167 @@
+//
+// Created by Szymon Ros on 17/10/2026.
+//
+#include "../include/pula_watkow.h"
+#include <algorithm>
+#include <stdexcept>
+
+using namespace std;
+
+namespace biblioteka_numeryczna {
+    // pula i indeks kolejki watku roboczego, ktory wykonuje biezacy kod (-1 poza pula)
+    static thread_local PulaWatkow* pulaBiezacegoWatku = nullptr;
+    static thread_local int indeksBiezacegoWatku = -1;
+
+    PulaWatkow::PulaWatkow(int liczbaWatkow) {
+        if (liczbaWatkow <= 0) {
+            liczbaWatkow = max(1u, thread::hardware_concurrency());
+        }
+        for (int i = 0; i < liczbaWatkow; i++) {
+            kolejki_.push_back(make_unique<Kolejka>());
+        }
+        for (int i = 0; i < liczbaWatkow; i++) {
+            watki_.emplace_back(&PulaWatkow::petlaWatku, this, i);
+        }
+    }
+
+    PulaWatkow::~PulaWatkow() {
+        {
+            lock_guard<mutex> lk(blokadaStanu_);
+            koniec_ = true;
+        }
+        jestPraca_.notify_all();
+        for (auto& watek : watki_) {
+            watek.join();
+        }
+    }
+
+    void PulaWatkow::dodaj(function<void()> zadanie) {
+        int indeks = pulaBiezacegoWatku == this
+                         ? indeksBiezacegoWatku
+                         : nastepnaKolejka_++ % kolejki_.size();
+        niezakonczone_++;
+        {
+            lock_guard<mutex> lk(kolejki_[indeks]->blokada);
+            kolejki_[indeks]->zadania.push_back(move(zadanie));
+        }
+        {
+            lock_guard<mutex> lk(blokadaStanu_);
+            wKolejkach_++;
+        }
+        jestPraca_.notify_one();
+    }
+
+    bool PulaWatkow::pobierz(int indeks, function<void()>& zadanie) {
+        // najpierw wlasna kolejka od konca, potem kradziez z poczatku cudzych
+        {
+            Kolejka& wlasna = *kolejki_[indeks];
+            lock_guard<mutex> lk(wlasna.blokada);
+            if (!wlasna.zadania.empty()) {
+                zadanie = move(wlasna.zadania.back());
+                wlasna.zadania.pop_back();
+                return true;
+            }
+        }
+        int n = kolejki_.size();
+        for (int przesuniecie = 1; przesuniecie < n; przesuniecie++) {
+            Kolejka& obca = *kolejki_[(indeks + przesuniecie) % n];
+            lock_guard<mutex> lk(obca.blokada);
+            if (!obca.zadania.empty()) {
+                zadanie = move(obca.zadania.front());
+                obca.zadania.pop_front();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void PulaWatkow::petlaWatku(int indeks) {
+        pulaBiezacegoWatku = this;
+        indeksBiezacegoWatku = indeks;
+
+        while (true) {
+            function<void()> zadanie;
+            if (pobierz(indeks, zadanie)) {
+                wKolejkach_--;
+                try {
+                    zadanie();
+                } catch (...) {
+                    lock_guard<mutex> lk(blokadaStanu_);
+                    if (!pierwszyBlad_) {
+                        pierwszyBlad_ = current_exception();
+                    }
+                }
+                if (--niezakonczone_ == 0) {
+                    lock_guard<mutex> lk(blokadaStanu_);
+                    wszystkoGotowe_.notify_all();
+                }
+                continue;
+            }
+
+            unique_lock<mutex> lk(blokadaStanu_);
+            jestPraca_.wait(lk, [this] { return koniec_ || wKolejkach_ > 0; });
+            if (koniec_ && wKolejkach_ <= 0) {
+                return;
+            }
+        }
+    }
+
+    void PulaWatkow::czekaj() {
+        if (pulaBiezacegoWatku == this) {
+            throw logic_error("PulaWatkow::czekaj nie może być wołane z wnętrza zadania");
+        }
+        unique_lock<mutex> lk(blokadaStanu_);
+        wszystkoGotowe_.wait(lk, [this] { return niezakonczone_ == 0; });
+        if (pierwszyBlad_) {
+            exception_ptr blad = pierwszyBlad_;
+            pierwszyBlad_ = nullptr;
+            rethrow_exception(blad);
+        }
+    }
+
+    int GrafZadan::dodajZadanie(function<void()> zadanie) {
+        wezly_.push_back(Wezel{move(zadanie), {}, 0});
+        return wezly_.size() - 1;
+    }
+
+    void GrafZadan::dodajZaleznosc(int poprzednik, int nastepnik) {
+        if (poprzednik < 0 || nastepnik < 0 || poprzednik >= (int)wezly_.size() || nastepnik >= (int)wezly_.size()) {
+            throw out_of_range("Nieprawidłowy identyfikator zadania");
+        }
+        wezly_[poprzednik].nastepniki.push_back(nastepnik);
+        wezly_[nastepnik].liczbaPoprzednikow++;
+    }
+
+    void GrafZadan::wykonaj(PulaWatkow& pula) {
+        int n = wezly_.size();
+        unique_ptr<atomic<int>[]> pozostalo(new atomic<int>[n]);
+        for (int i = 0; i < n; i++) {
+            pozostalo[i] = wezly_[i].liczbaPoprzednikow;
+        }
+        atomic<bool> blad{false};
+
+        // po zakonczeniu zadania zwalniamy nastepniki, ktorym nie zostal juz zaden poprzednik
+        function<void(int)> uruchom = [&](int id) {
+            if (!blad) {
+                try {
+                    wezly_[id].zadanie();
+                } catch (...) {
+                    blad = true;
+                    throw;
+                }
+            }
+            for (int nastepnik : wezly_[id].nastepniki) {
+                if (--pozostalo[nastepnik] == 0) {
+                    pula.dodaj([&uruchom, nastepnik] { uruchom(nastepnik); });
+                }
+            }
+        };
+
+        for (int i = 0; i < n; i++) {
+            if (wezly_[i].liczbaPoprzednikow == 0) {
+                pula.dodaj([&uruchom, i] { uruchom(i); });
+            }
+        }
+        pula.czekaj();
+    }
+}
@@ -0,0 +1,378 @@
+//
+// Created by Szymon Ros on 17/10/2026.
+//
+#include "../include/rozklady_rzadkie.h"
+#include "../include/sledzenie.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+using namespace std;
+
+namespace biblioteka_numeryczna {
+    AnalizaSymboliczna::AnalizaSymboliczna(const MacierzRzadkaCSR& A, Uporzadkowanie rodzaj)
+        : AnalizaSymboliczna(A, wyznaczUporzadkowanie(A, rodzaj)) {}
+
+    AnalizaSymboliczna::AnalizaSymboliczna(const MacierzRzadkaCSR& A, const vector<int>& permutacja)
+        : permutacja_(permutacja) {
+        analizuj(A);
+    }
+
+    void AnalizaSymboliczna::analizuj(const MacierzRzadkaCSR& A) {
+        if (A.wiersze() != A.kolumny()) {
+            throw invalid_argument("Macierz musi być kwadratowa");
+        }
+        n_ = A.wiersze();
+        if ((int)permutacja_.size() != n_) {
+            throw invalid_argument("Nieprawidłowa permutacja");
+        }
+        odwrotna_.assign(n_, -1);
+        for (int k = 0; k < n_; k++) {
+            int i = permutacja_[k];
+            if (i < 0 || i >= n_ || odwrotna_[i] != -1) {
+                throw invalid_argument("Nieprawidłowa permutacja");
+            }
+            odwrotna_[i] = k;
+        }
+        wzorzecPoczatki_ = A.poczatkiWierszy();
+        wzorzecKolumny_ = A.indeksyKolumn();
+
+        // kolumny P A P^T z odwolaniami do A.wartosci()
+        const vector<int>& poczatki = A.poczatkiWierszy();
+        const vector<int>& kolumny = A.indeksyKolumn();
+        poczatkiKolumnA_.assign(n_ + 1, 0);
+        for (int j : kolumny) {
+            poczatkiKolumnA_[odwrotna_[j] + 1]++;
+        }
+        for (int j = 0; j < n_; j++) {
+            poczatkiKolumnA_[j + 1] += poczatkiKolumnA_[j];
+        }
+        wierszeA_.resize(kolumny.size());
+        zrodlaA_.resize(kolumny.size());
+        vector<int> pozycja(poczatkiKolumnA_.begin(), poczatkiKolumnA_.end() - 1);
+        for (int i = 0; i < n_; i++) {
+            for (int p = poczatki[i]; p < poczatki[i + 1]; p++) {
+                int q = pozycja[odwrotna_[kolumny[p]]]++;
+                wierszeA_[q] = odwrotna_[i];
+                zrodlaA_[q] = p;
+            }
+        }
+
+        vector<int> poczatkiGrafu, sasiedzi;
+        grafSymetryczny(A, poczatkiGrafu, sasiedzi);
+
+        // drzewo eliminacji (Liu) z kompresja sciezek przez przodek[]
+        rodzic_.assign(n_, -1);
+        vector<int> przodek(n_, -1);
+        for (int k = 0; k < n_; k++) {
+            int stary = permutacja_[k];
+            for (int p = poczatkiGrafu[stary]; p < poczatkiGrafu[stary + 1]; p++) {
+                int i = odwrotna_[sasiedzi[p]];
+                while (i != -1 && i < k) {
+                    int nastepny = przodek[i];
+                    przodek[i] = k;
+                    if (nastepny == -1) {
+                        rodzic_[i] = k;
+                    }
+                    i = nastepny;
+                }
+            }
+        }
+
+        // wiersz i czynnika L: wierzcholki na sciezkach w drzewie od sasiadow k < i do i
+        vector<int> znacznik(n_, -1);
+        poczatkiWierszyL_.assign(n_ + 1, 0);
+        kolumnyWierszyL_.clear();
+        for (int i = 0; i < n_; i++) {
+            znacznik[i] = i;
+            size_t poczatekWiersza = kolumnyWierszyL_.size();
+            int stary = permutacja_[i];
+            for (int p = poczatkiGrafu[stary]; p < poczatkiGrafu[stary + 1]; p++) {
+                int k = odwrotna_[sasiedzi[p]];
+                if (k > i) {
+                    continue;
+                }
+                while (znacznik[k] != i) {
+                    kolumnyWierszyL_.push_back(k);
+                    znacznik[k] = i;
+                    k = rodzic_[k];
+                }
+            }
+            sort(kolumnyWierszyL_.begin() + poczatekWiersza, kolumnyWierszyL_.end());
+            poczatkiWierszyL_[i + 1] = kolumnyWierszyL_.size();
+        }
+
+        // te same elementy kolumnami; wiersze sa przegladane rosnaco, wiec w kolumnach tez sa rosnaco
+        poczatkiKolumnL_.assign(n_ + 1, 0);
+        for (int k : kolumnyWierszyL_) {
+            poczatkiKolumnL_[k + 1]++;
+        }
+        for (int k = 0; k < n_; k++) {
+            poczatkiKolumnL_[k + 1] += poczatkiKolumnL_[k];
+        }
+        wierszeL_.resize(kolumnyWierszyL_.size());
+        pozycjeWierszyL_.resize(kolumnyWierszyL_.size());
+        pozycja.assign(poczatkiKolumnL_.begin(), poczatkiKolumnL_.end() - 1);
+        for (int i = 0; i < n_; i++) {
+            for (int t = poczatkiWierszyL_[i]; t < poczatkiWierszyL_[i + 1]; t++) {
+                int q = pozycja[kolumnyWierszyL_[t]]++;
+                wierszeL_[q] = i;
+                pozycjeWierszyL_[t] = q;
+            }
+        }
+    }
+
+    bool AnalizaSymboliczna::zgodna(const MacierzRzadkaCSR& A) const {
+        return A.wiersze() == n_ && A.kolumny() == n_ && A.poczatkiWierszy() == wzorzecPoczatki_ &&
+               A.indeksyKolumn() == wzorzecKolumny_;
+    }
+
+    static void sprawdzAnalize(const MacierzRzadkaCSR& A, const shared_ptr<const AnalizaSymboliczna>& analiza) {
+        if (!analiza) {
+            throw invalid_argument("Brak analizy symbolicznej");
+        }
+        if (!analiza->zgodna(A)) {
+            throw invalid_argument("Wzorzec macierzy nie odpowiada analizie symbolicznej");
+        }
+    }
+
+    static double normaMaksimum(const vector<double>& v) {
+        double m = 0.0;
+        for (double x : v) {
+            m = max(m, fabs(x));
+        }
+        return m;
+    }
+
+    RozkladRzadkiLU::RozkladRzadkiLU(const MacierzRzadkaCSR& A, shared_ptr<const AnalizaSymboliczna> analiza)
+        : analiza_(move(analiza)) {
+        sprawdzAnalize(A, analiza_);
+        rozloz(A);
+    }
+
+    RozkladRzadkiLU::RozkladRzadkiLU(const MacierzRzadkaCSR& A, Uporzadkowanie rodzaj)
+        : RozkladRzadkiLU(A, make_shared<const AnalizaSymboliczna>(A, rodzaj)) {}
+
+    void RozkladRzadkiLU::rozloz(const MacierzRzadkaCSR& A) {
+        const AnalizaSymboliczna& s = *analiza_;
+        int n = s.n_;
+        const vector<double>& wartosci = A.wartosci();
+        L_.assign(s.wierszeL_.size(), 0.0);
+        U_.assign(s.kolumnyWierszyL_.size(), 0.0);
+        przekatna_.assign(n, 0.0);
+
+        double prog = sqrt(numeric_limits<double>::epsilon()) * normaMaksimum(wartosci);
+        if (n > 0 && prog == 0.0) {
+            throw runtime_error("Macierz jest osobliwa");
+        }
+
+        // kolumna j: x = A(:, j), rozwiazanie L x = A(:, j) po wzorcu wiersza j (U(:, j)), potem L(:, j)
+        vector<double> x(n, 0.0);
+        for (int j = 0; j < n; j++) {
+            for (int p = s.poczatkiKolumnA_[j]; p < s.poczatkiKolumnA_[j + 1]; p++) {
+                x[s.wierszeA_[p]] += wartosci[s.zrodlaA_[p]];
+            }
+            for (int t = s.poczatkiWierszyL_[j]; t < s.poczatkiWierszyL_[j + 1]; t++) {
+                int k = s.kolumnyWierszyL_[t];
+                double u = x[k];
+                x[k] = 0.0;
+                U_[t] = u;
+                for (int q = s.poczatkiKolumnL_[k]; q < s.poczatkiKolumnL_[k + 1]; q++) {
+                    x[s.wierszeL_[q]] -= L_[q] * u;
+                }
+            }
+
+            double d = x[j];
+            x[j] = 0.0;
+            if (fabs(d) < prog) {
+                d = d < 0.0 ? -prog : prog;
+                liczbaZaburzonych_++;
+            }
+            przekatna_[j] = d;
+            for (int q = s.poczatkiKolumnL_[j]; q < s.poczatkiKolumnL_[j + 1]; q++) {
+                L_[q] = x[s.wierszeL_[q]] / d;
+                x[s.wierszeL_[q]] = 0.0;
+            }
+        }
+
+        if (liczbaZaburzonych_ > 0) {
+            A_ = A;
+        }
+    }
+
+    void RozkladRzadkiLU::rozwiazCzynnikami(vector<double>& x) const {
+        const AnalizaSymboliczna& s = *analiza_;
+        int n = s.n_;
+        for (int j = 0; j < n; j++) {
+            double x_j = x[j];
+            for (int q = s.poczatkiKolumnL_[j]; q < s.poczatkiKolumnL_[j + 1]; q++) {
+                x[s.wierszeL_[q]] -= L_[q] * x_j;
+            }
+        }
+        for (int j = n - 1; j >= 0; j--) {
+            x[j] /= przekatna_[j];
+            double x_j = x[j];
+            for (int t = s.poczatkiWierszyL_[j]; t < s.poczatkiWierszyL_[j + 1]; t++) {
+                x[s.kolumnyWierszyL_[t]] -= U_[t] * x_j;
+            }
+        }
+    }
+
+    vector<double> RozkladRzadkiLU::solve(const vector<double>& b) const {
+        RaportZbieznosci raport = solve_zRaportem(b);
+        if (!raport.zbiezny) {
+            SLEDZ(ostrzezenie("RozkladRzadkiLU: poprawianie iteracyjne nie osiągnęło dokładności (residuum = " +
+                              to_string(raport.residuum) + ", zaburzone elementy główne: " +
+                              to_string(liczbaZaburzonych_) + ")"));
+        }
+        return move(raport.x);
+    }
+
+    RaportZbieznosci RozkladRzadkiLU::solve_zRaportem(const vector<double>& b) const {
+        const AnalizaSymboliczna& s = *analiza_;
+        int n = s.n_;
+        if (b.size() != n) {
+            throw invalid_argument("Nieprawidłowe wymiary macierzy lub wektora");
+        }
+
+        auto rozwiaz = [&](const vector<double>& prawa) {
+            vector<double> y(n);
+            for (int i = 0; i < n; i++) {
+                y[i] = prawa[s.permutacja_[i]];
+            }
+            rozwiazCzynnikami(y);
+            vector<double> wynik(n);
+            for (int i = 0; i < n; i++) {
+                wynik[s.permutacja_[i]] = y[i];
+            }
+            return wynik;
+        };
+
+        RaportZbieznosci raport;
+        raport.x = rozwiaz(b);
+        if (liczbaZaburzonych_ == 0) {
+            raport.zbiezny = true;
+            return raport;
+        }
+
+        // poprawianie iteracyjne: zaburzone elementy glowne daja rozklad macierzy bliskiej A;
+        // przerywane, gdy residuum spadnie do poziomu zaokraglen albo przestanie malec
+        const int MAKS_KROKOW = 10;
+        double normaA = normaMaksimum(A_.wartosci());
+        double normaB = normaMaksimum(b);
+        double normaBLiczona = normaB > 0.0 ? normaB : 1.0;
+        vector<double>& x = raport.x;
+        for (int krok = 0; ; krok++) {
+            vector<double> r = pomnoz(A_, x);
+            for (int i = 0; i < n; i++) {
+                r[i] = b[i] - r[i];
+            }
+            double normaR = normaMaksimum(r);
+            raport.historiaResiduum.push_back(normaR);
+            raport.residuum = normaR;
+            raport.residuumWzgledne = normaR / normaBLiczona;
+            if (normaR <= 1e-14 * (normaA * normaMaksimum(x) + normaB)) {
+                raport.zbiezny = true;
+                break;
+            }
+            if (krok == MAKS_KROKOW || (krok > 0 && normaR >= raport.historiaResiduum[krok - 1])) {
+                break;
+            }
+            vector<double> dx = rozwiaz(r);
+            for (int i = 0; i < n; i++) {
+                x[i] += dx[i];
+            }
+            raport.iteracje++;
+        }
+        return raport;
+    }
+
+    RozkladRzadkiCholeskyego::RozkladRzadkiCholeskyego(const MacierzRzadkaCSR& A,
+                                                       shared_ptr<const AnalizaSymboliczna> analiza)
+        : analiza_(move(analiza)) {
+        sprawdzAnalize(A, analiza_);
+        rozloz(A);
+    }
+
+    RozkladRzadkiCholeskyego::RozkladRzadkiCholeskyego(const MacierzRzadkaCSR& A, Uporzadkowanie rodzaj)
+        : RozkladRzadkiCholeskyego(A, make_shared<const AnalizaSymboliczna>(A, rodzaj)) {}
+
+    void RozkladRzadkiCholeskyego::rozloz(const MacierzRzadkaCSR& A) {
+        const AnalizaSymboliczna& s = *analiza_;
+        int n = s.n_;
+        const vector<double>& wartosci = A.wartosci();
+        L_.assign(s.wierszeL_.size(), 0.0);
+        przekatna_.assign(n, 0.0);
+
+        // lewostronnie: kolumna j = A(j:n, j) - suma po k z wiersza j L(j:n, k) L(j, k)
+        vector<double> x(n, 0.0);
+        for (int j = 0; j < n; j++) {
+            for (int p = s.poczatkiKolumnA_[j]; p < s.poczatkiKolumnA_[j + 1]; p++) {
+                if (s.wierszeA_[p] >= j) {
+                    x[s.wierszeA_[p]] += wartosci[s.zrodlaA_[p]];
+                }
+            }
+            for (int t = s.poczatkiWierszyL_[j]; t < s.poczatkiWierszyL_[j + 1]; t++) {
+                int k = s.kolumnyWierszyL_[t];
+                int q0 = s.pozycjeWierszyL_[t];
+                double l_jk = L_[q0];
+                x[j] -= l_jk * l_jk;
+                for (int q = q0 + 1; q < s.poczatkiKolumnL_[k + 1]; q++) {
+                    x[s.wierszeL_[q]] -= L_[q] * l_jk;
+                }
+            }
+
+            double d = x[j];
+            x[j] = 0.0;
+            if (!(d > 0.0)) {
+                status_ = StatusRozkladu::NieDodatnioOkreslona;
+                kolumnaBledu_ = s.permutacja_[j];
+                return;
+            }
+            double l_jj = sqrt(d);
+            przekatna_[j] = l_jj;
+            for (int q = s.poczatkiKolumnL_[j]; q < s.poczatkiKolumnL_[j + 1]; q++) {
+                L_[q] = x[s.wierszeL_[q]] / l_jj;
+                x[s.wierszeL_[q]] = 0.0;
+            }
+        }
+    }
+
+    vector<double> RozkladRzadkiCholeskyego::solve(const vector<double>& b) const {
+        if (status_ != StatusRozkladu::Poprawny) {
+            throw runtime_error("Rozkład Cholesky'ego nie powiódł się: macierz nie jest dodatnio określona (kolumna " +
+                                to_string(kolumnaBledu_ + 1) + ")");
+        }
+        const AnalizaSymboliczna& s = *analiza_;
+        int n = s.n_;
+        if (b.size() != n) {
+            throw invalid_argument("Nieprawidłowe wymiary macierzy lub wektora");
+        }
+
+        vector<double> y(n);
+        for (int i = 0; i < n; i++) {
+            y[i] = b[s.permutacja_[i]];
+        }
+        for (int j = 0; j < n; j++) {
+            y[j] /= przekatna_[j];
+            double y_j = y[j];
+            for (int q = s.poczatkiKolumnL_[j]; q < s.poczatkiKolumnL_[j + 1]; q++) {
+                y[s.wierszeL_[q]] -= L_[q] * y_j;
+            }
+        }
+        for (int j = n - 1; j >= 0; j--) {
+            double suma = y[j];
+            for (int q = s.poczatkiKolumnL_[j]; q < s.poczatkiKolumnL_[j + 1]; q++) {
+                suma -= L_[q] * y[s.wierszeL_[q]];
+            }
+            y[j] = suma / przekatna_[j];
+        }
+
+        vector<double> x(n);
+        for (int i = 0; i < n; i++) {
+            x[s.permutacja_[i]] = y[i];
+        }
+        return x;
+    }
+}
@@ -0,0 +1,38 @@
+//
+// Created by Szymon Ros on 17/10/2026.
+//
+#include "../include/sledzenie.h"
+#include "../include/uklady_liniowe.h"
+#include <atomic>
+#include <iostream>
+
+using namespace std;
+
+namespace biblioteka_numeryczna {
+    static SledzenieWylaczone sledzeniePuste;
+    static atomic<Sledzenie*> aktywneSledzenie{&sledzeniePuste};
+
+    Sledzenie* ustawSledzenie(Sledzenie* sledzenie) {
+        return aktywneSledzenie.exchange(sledzenie != nullptr ? sledzenie : &sledzeniePuste);
+    }
+
+    Sledzenie& sledzenie() {
+        return *aktywneSledzenie.load(memory_order_acquire);
+    }
+
+    void SledzenieKonsola::komunikat(const string& tekst) {
+        cout << tekst << endl;
+    }
+
+    void SledzenieKonsola::ostrzezenie(const string& tekst) {
+        cerr << tekst << endl;
+    }
+
+    void SledzenieKonsola::macierz(const Macierz& macierz, const string& nazwa) {
+        wyswietlMacierz(macierz, nazwa);
+    }
+
+    void SledzenieKonsola::wektor(const vector<double>& wektor, const string& nazwa) {
+        wyswietlWektor(wektor, nazwa);
+    }
+}
@@ -2,64 +2,102 @@
 // Created by Szymon Ros on 10/06/2025.
 //
 #include "../include/uklady_liniowe.h"
+#include "../include/sledzenie.h"
+#include "../include/jadra_simd.h"
+#include "../include/plik_mapowany.h"
+#include "../include/pamiec_rozkladow.h"
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cctype>
+#include <cstring>
 #include <cmath>
 #include <stdexcept>
 #include <fstream>
 #include <iostream>
+#include <iomanip>
+#include <limits>
 #include <sstream>
 
 using namespace std;
 
 namespace biblioteka_numeryczna {
-    vector<double> eliminacjaGaussa(vector<vector<double>>& macierz_A,
+    // liczba w domyslnym formacie strumienia, do komunikatow sledzenia
+    static string tekst(double wartosc) {
+        ostringstream ss;
+        ss << wartosc;
+        return ss.str();
+    }
+
+    vector<double> eliminacjaGaussa(Macierz& macierz_A,
                                    vector<double>& wektor_b) {
-        int n = macierz_A.size();
-        if (n == 0 || wektor_b.size() != n) {
+        int n = macierz_A.wiersze();
+        if (n == 0 || macierz_A.kolumny() != n || wektor_b.size() != n) {
             throw invalid_argument("Nieprawidłowe wymiary macierzy lub wektora");
         }
 
+        if (PamiecRozkladow* pamiec = pamiecRozkladow()) {
+            return pamiec->rozklad(macierz_A)->solve(wektor_b);
+        }
+
         // Eliminacja w przód
         for (int i = 0; i < n; i++) {
             // Znajdź element główny
             int max_wiersz = i;
             for (int k = i + 1; k < n; k++) {
-                if (abs(macierz_A[k][i]) > abs(macierz_A[max_wiersz][i])) {
+                if (abs(macierz_A(k, i)) > abs(macierz_A(max_wiersz, i))) {
                     max_wiersz = k;
                 }
             }
 
             // Zamień wiersze
-            swap(macierz_A[i], macierz_A[max_wiersz]);
+            macierz_A.zamienWiersze(i, max_wiersz);
             swap(wektor_b[i], wektor_b[max_wiersz]);
 
             // Sprawdź czy element główny nie jest zerem
-            if (abs(macierz_A[i][i]) < 1e-10) {
+            if (abs(macierz_A(i, i)) < 1e-10) {
                 throw runtime_error("Macierz jest osobliwa");
             }
 
             // Eliminuj kolumnę
+            const double* wiersz_i = macierz_A.wiersz(i);
             for (int k = i + 1; k < n; k++) {
-                double wspolczynnik = macierz_A[k][i] / macierz_A[i][i];
-                for (int j = i; j < n; j++) {
-                    macierz_A[k][j] -= wspolczynnik * macierz_A[i][j];
-                }
+                double* wiersz_k = macierz_A.wiersz(k);
+                double wspolczynnik = wiersz_k[i] / wiersz_i[i];
+                axpy(n - i, -wspolczynnik, wiersz_i + i, wiersz_k + i);
                 wektor_b[k] -= wspolczynnik * wektor_b[i];
             }
         }
 
         // Podstawienie wsteczne
-        vector<double> rozwiazanie(n);
-        for (int i = n - 1; i >= 0; i--) {
-            rozwiazanie[i] = wektor_b[i];
-            for (int j = i + 1; j < n; j++) {
-                rozwiazanie[i] -= macierz_A[i][j] * rozwiazanie[j];
-            }
-            rozwiazanie[i] /= macierz_A[i][i];
+        vector<double> rozwiazanie = wektor_b;
+        podstawianieWstecz(macierz_A, rozwiazanie.data());
+
+        return rozwiazanie;
+    }
+
+    vector<double> eliminacjaGaussa(vector<vector<double>>& macierz_A,
+                                   vector<double>& wektor_b) {
+        int n = macierz_A.size();
+        if (n == 0 || wektor_b.size() != n) {
+            throw invalid_argument("Nieprawidłowe wymiary macierzy lub wektora");
         }
 
+        Macierz A(macierz_A);
+        vector<double> rozwiazanie = eliminacjaGaussa(A, wektor_b);
+        macierz_A = A.doWektorow();
         return rozwiazanie;
     }
 
+    vector<double> metodaGaussaSeidela(const Macierz& macierz_A,
+                                      const vector<double>& wektor_b,
+                                      const vector<double>& przyblizenie_poczatkowe,
+                                      double tolerancja,
+                                      int max_iteracji) {
+        KryteriumZbieznosci kryterium{0.0, 0.0, max_iteracji, tolerancja};
+        return metodaGaussaSeidela(macierz_A, wektor_b, przyblizenie_poczatkowe, kryterium).x;
+    }
+
     vector<double> metodaGaussaSeidela(const vector<vector<double>>& macierz_A,
                                       const vector<double>& wektor_b,
                                       const vector<double>& przyblizenie_poczatkowe,
@@ -70,344 +108,2715 @@ namespace biblioteka_numeryczna {
             throw invalid_argument("Nieprawidłowe wymiary");
         }
 
-        vector<double> x = przyblizenie_poczatkowe;
-        vector<double> x_nowe(n);
-
-        for (int iteracja = 0; iteracja < max_iteracji; iteracja++) {
-            for (int i = 0; i < n; i++) {
-                double suma = 0;
-                for (int j = 0; j < n; j++) {
-                    if (i != j) {
-                        suma += macierz_A[i][j] * x[j];
-                    }
-                }
-                x_nowe[i] = (wektor_b[i] - suma) / macierz_A[i][i];
-                x[i] = x_nowe[i]; // Aktualizuj od razu (różnica od Jacobiego)
-            }
+        return metodaGaussaSeidela(Macierz(macierz_A), wektor_b, przyblizenie_poczatkowe,
+                                   tolerancja, max_iteracji);
+    }
 
-            // Sprawdź zbieżność
-            double norma_bledu = 0;
-            for (int i = 0; i < n; i++) {
-                norma_bledu += abs(x_nowe[i] - x[i]);
-            }
-            if (norma_bledu < tolerancja) {
-                break;
+    // indeksy elementow przekatnej w tablicy wartosci; metody iteracyjne wymagaja niezerowej przekatnej
+    static vector<int> przekatnaDoIteracji(const MacierzRzadkaCSR& A,
+                                           const vector<double>& wektor_b,
+                                           const vector<double>& przyblizenie_poczatkowe) {
+        int n = A.wiersze();
+        if (n == 0 || A.kolumny() != n || wektor_b.size() != n || przyblizenie_poczatkowe.size() != n) {
+            throw invalid_argument("Nieprawidłowe wymiary");
+        }
+        vector<int> przekatna = A.indeksyPrzekatnej();
+        for (int i = 0; i < n; i++) {
+            if (przekatna[i] < 0 || A.wartosci()[przekatna[i]] == 0.0) {
+                throw runtime_error("Zerowy element na przekątnej w wierszu " + to_string(i + 1));
             }
         }
-
-        return x;
+        return przekatna;
     }
-    void wczytajDane(const string& nazwaPliku, vector<vector<double>>& A, vector<double>& B, int& N) {
-        ifstream plik(nazwaPliku);
-        if (!plik) {
-            cerr << "Nie można otworzyć pliku: " << nazwaPliku << endl;
-            return;
-        }
-        if (!plik) {
-            string sciezkaAlternatywna = "../" + nazwaPliku;
-            plik.open(sciezkaAlternatywna);
-        }
-
-        string linia;
-        getline(plik, linia);
-
-        getline(plik, linia);               //liczba niewiadomych
-        stringstream ss(linia);
-        string tmp;
-        ss >> tmp >> N;
 
-        A.resize(N, vector<double>(N, 0));
-        B.resize(N, 0);
-
-        getline(plik, linia);
+    // residuum b_i - A_i x wiersza i
+    static inline double residuumWiersza(const vector<int>& poczatki, const vector<int>& kolumny,
+                                         const vector<double>& wartosci, const vector<double>& wektor_b,
+                                         const vector<double>& x, int i) {
+        double suma = 0.0;
+        for (int p = poczatki[i]; p < poczatki[i + 1]; p++) {
+            suma += wartosci[p] * x[kolumny[p]];
+        }
+        return wektor_b[i] - suma;
+    }
 
-        getline(plik, linia);                       //wektor wyrazow wolnych
-        stringstream ssB(linia);
-        for (int i = 0; i < N; i++) {
-            ssB >> B[i];
+    // jeden przebieg SOR po zapisanych elementach (omega = 1 to Gauss-Seidel); zwraca sume |x_nowe - x|,
+    // w kwadratResiduum sume kwadratow residuum wierszy w chwili ich aktualizacji (b_i - A_i x = a_ii (x_gs - x_i))
+    static double przebiegSOR(const MacierzRzadkaCSR& A, const vector<double>& wektor_b,
+                              const vector<int>& przekatna, double omega, vector<double>& x,
+                              double& kwadratResiduum) {
+        const vector<int>& poczatki = A.poczatkiWierszy();
+        const vector<int>& kolumny = A.indeksyKolumn();
+        const vector<double>& wartosci = A.wartosci();
+
+        double norma_kroku = 0.0;
+        kwadratResiduum = 0.0;
+        for (int i = 0; i < A.wiersze(); i++) {
+            double a_ii = wartosci[przekatna[i]];
+            double r_i = residuumWiersza(poczatki, kolumny, wartosci, wektor_b, x, i);
+            double x_gs = x[i] + r_i / a_ii;
+            double x_nowe = x[i] + omega * (x_gs - x[i]);
+            norma_kroku += fabs(x_nowe - x[i]);
+            kwadratResiduum += r_i * r_i;
+            x[i] = x_nowe;
         }
+        return norma_kroku;
+    }
 
-        getline(plik, linia);
+    vector<double> metodaSOR(const MacierzRzadkaCSR& macierz_A,
+                             const vector<double>& wektor_b,
+                             const vector<double>& przyblizenie_poczatkowe,
+                             double omega,
+                             double tolerancja,
+                             int max_iteracji) {
+        if (omega <= 0.0 || omega >= 2.0) {
+            throw invalid_argument("Parametr relaksacji omega musi należeć do przedziału (0, 2)");
+        }
+        vector<int> przekatna = przekatnaDoIteracji(macierz_A, wektor_b, przyblizenie_poczatkowe);
 
-        for (int i = 0; i < N; i++) {                       //wektor wspolczynnikow
-            getline(plik, linia);
-            stringstream ssA(linia);
-            for (int j = 0; j < N; j++) {
-                ssA >> A[i][j];
+        vector<double> x = przyblizenie_poczatkowe;
+        double kwadratResiduum;
+        for (int iteracja = 0; iteracja < max_iteracji; iteracja++) {
+            if (przebiegSOR(macierz_A, wektor_b, przekatna, omega, x, kwadratResiduum) < tolerancja) {
+                break;
             }
         }
+        return x;
+    }
 
-        plik.close();
+    vector<double> metodaGaussaSeidela(const MacierzRzadkaCSR& macierz_A,
+                                      const vector<double>& wektor_b,
+                                      const vector<double>& przyblizenie_poczatkowe,
+                                      double tolerancja,
+                                      int max_iteracji) {
+        return metodaSOR(macierz_A, wektor_b, przyblizenie_poczatkowe, 1.0, tolerancja, max_iteracji);
     }
-       void rozkladLU_zPivotingiem(const vector<vector<double>>& A,
-                               vector<vector<double>>& L,
-                               vector<vector<double>>& U,
-                               vector<int>& P) {
-        int n = A.size();
 
-        U.resize(n, vector<double>(n, 0.0));
-        L.resize(n, vector<double>(n, 0.0));
-        P.resize(n);
+    vector<double> metodaGaussaSeidelaKolorowa(const MacierzRzadkaCSR& macierz_A,
+                                               const vector<double>& wektor_b,
+                                               const vector<double>& przyblizenie_poczatkowe,
+                                               const vector<int>& kolory,
+                                               PulaWatkow& pula,
+                                               double tolerancja,
+                                               int max_iteracji) {
+        vector<int> przekatna = przekatnaDoIteracji(macierz_A, wektor_b, przyblizenie_poczatkowe);
+        if (!poprawneKolorowanie(macierz_A, kolory)) {
+            throw invalid_argument("Kolorowanie nie pasuje do macierzy (sąsiednie wiersze mają ten sam kolor)");
+        }
+        const vector<int>& poczatki = macierz_A.poczatkiWierszy();
+        const vector<int>& kolumny = macierz_A.indeksyKolumn();
+        const vector<double>& wartosci = macierz_A.wartosci();
+
+        // wiersze pogrupowane wedlug kolorow, kazda klasa pocieta na fragmenty dla watkow
+        int liczbaKolorow = *max_element(kolory.begin(), kolory.end()) + 1;
+        vector<vector<int>> klasy(liczbaKolorow);
+        for (int i = 0; i < (int)kolory.size(); i++) {
+            klasy[kolory[i]].push_back(i);
+        }
+        const int minimalnyFragment = 256;
+        int liczbaFragmentow = 4 * pula.liczbaWatkow();
+        vector<double> normyFragmentow(liczbaFragmentow);
 
-        for (int i = 0; i < n; i++) {
-            for (int j = 0; j < n; j++) {
-                U[i][j] = A[i][j];
+        vector<double> x = przyblizenie_poczatkowe;
+        for (int iteracja = 0; iteracja < max_iteracji; iteracja++) {
+            double norma_kroku = 0.0;
+            for (const vector<int>& klasa : klasy) {
+                int rozmiar = klasa.size();
+                int fragmenty = max(1, min(liczbaFragmentow, rozmiar / minimalnyFragment));
+                auto aktualizuj = [&, rozmiar, fragmenty](int f) {
+                    double norma = 0.0;
+                    for (int k = (long long)rozmiar * f / fragmenty; k < (long long)rozmiar * (f + 1) / fragmenty; k++) {
+                        int i = klasa[k];
+                        double delta = residuumWiersza(poczatki, kolumny, wartosci, wektor_b, x, i) / wartosci[przekatna[i]];
+                        x[i] += delta;
+                        norma += fabs(delta);
+                    }
+                    normyFragmentow[f] = norma;
+                };
+                if (fragmenty == 1) {
+                    aktualizuj(0);
+                } else {
+                    for (int f = 0; f < fragmenty; f++) {
+                        pula.dodaj([&aktualizuj, f] { aktualizuj(f); });
+                    }
+                    pula.czekaj();
+                }
+                for (int f = 0; f < fragmenty; f++) {
+                    norma_kroku += normyFragmentow[f];
+                }
+            }
+            if (norma_kroku < tolerancja) {
+                break;
             }
-            P[i] = i;
-            L[i][i] = 1.0;
         }
+        return x;
+    }
 
-        for (int k = 0; k < n; k++) {
-            cout << "Iteracja " << k+1 << endl;
+    vector<double> metodaGaussaSeidelaKolorowa(const MacierzRzadkaCSR& macierz_A,
+                                               const vector<double>& wektor_b,
+                                               const vector<double>& przyblizenie_poczatkowe,
+                                               const vector<int>& kolory,
+                                               double tolerancja,
+                                               int max_iteracji,
+                                               int liczbaWatkow) {
+        PulaWatkow pula(liczbaWatkow);
+        return metodaGaussaSeidelaKolorowa(macierz_A, wektor_b, przyblizenie_poczatkowe, kolory, pula,
+                                           tolerancja, max_iteracji);
+    }
 
-            double max_val = 0.0;
-            int max_idx = k;
+    vector<double> metodaJacobiego(const MacierzRzadkaCSR& macierz_A,
+                                   const vector<double>& wektor_b,
+                                   const vector<double>& przyblizenie_poczatkowe,
+                                   double tolerancja,
+                                   int max_iteracji) {
+        vector<int> przekatna = przekatnaDoIteracji(macierz_A, wektor_b, przyblizenie_poczatkowe);
+        const vector<int>& poczatki = macierz_A.poczatkiWierszy();
+        const vector<int>& kolumny = macierz_A.indeksyKolumn();
+        const vector<double>& wartosci = macierz_A.wartosci();
+        int n = macierz_A.wiersze();
 
-            for (int i = k; i < n; i++) {
-                double abs_val = fabs(U[i][k]);
-                if (abs_val > max_val) {
-                    max_val = abs_val;
-                    max_idx = i;
+        vector<double> x = przyblizenie_poczatkowe;
+        vector<double> x_nowe(n);
+        for (int iteracja = 0; iteracja < max_iteracji; iteracja++) {
+            double norma_kroku = 0.0;
+            for (int i = 0; i < n; i++) {
+                double suma = 0.0;
+                for (int p = poczatki[i]; p < poczatki[i + 1]; p++) {
+                    suma += wartosci[p] * x[kolumny[p]];
                 }
+                double a_ii = wartosci[przekatna[i]];
+                suma -= a_ii * x[i];
+                x_nowe[i] = (wektor_b[i] - suma) / a_ii;
+                norma_kroku += fabs(x_nowe[i] - x[i]);
             }
-            if (max_val < 1e-10) {
-                cerr << "Macierz jest osobliwa!" << endl;
+            x.swap(x_nowe);   // Jacobi: caly przebieg liczony ze starego x
+            if (norma_kroku < tolerancja) {
+                break;
             }
+        }
+        return x;
+    }
 
-            if (max_idx != k) {
-                cout << "Zamiana wierszy: " << k+1 << " i " << max_idx+1 << endl;
-
-                swap(P[k], P[max_idx]);
-                swap(U[k], U[max_idx]);
+    OperatorLiniowy operatorMacierzy(const Macierz& A) {
+        return [&A](const vector<double>& x, vector<double>& y) {
+            y.resize(A.wiersze());
+            for (int i = 0; i < A.wiersze(); i++) {
+                y[i] = iloczynSkalarny(A.kolumny(), A.wiersz(i), x.data());
+            }
+        };
+    }
 
-                for (int j = 0; j < k; j++) {
-                    swap(L[k][j], L[max_idx][j]);
+    OperatorLiniowy operatorMacierzy(const MacierzRzadkaCSR& A) {
+        return [&A](const vector<double>& x, vector<double>& y) {
+            const vector<int>& poczatki = A.poczatkiWierszy();
+            const vector<int>& kolumny = A.indeksyKolumn();
+            const vector<double>& wartosci = A.wartosci();
+            y.resize(A.wiersze());
+            for (int i = 0; i < A.wiersze(); i++) {
+                double suma = 0.0;
+                for (int p = poczatki[i]; p < poczatki[i + 1]; p++) {
+                    suma += wartosci[p] * x[kolumny[p]];
                 }
+                y[i] = suma;
             }
+        };
+    }
 
-            for (int i = k + 1; i < n; i++) {
-                L[i][k] = U[i][k] / U[k][k];
+    OperatorLiniowy operatorMacierzy(const WidokMacierzy& A) {
+        return [A](const vector<double>& x, vector<double>& y) {
+            y.resize(A.wiersze());
+            for (int i = 0; i < A.wiersze(); i++) {
+                y[i] = iloczynSkalarny(A.kolumny(), A.wiersz(i), x.data());
+            }
+        };
+    }
 
-                for (int j = k; j < n; j++) {
-                    U[i][j] = U[i][j] - L[i][k] * U[k][j];
+    OperatorLiniowy operatorMacierzy(const WidokCSR& A) {
+        return [A](const vector<double>& x, vector<double>& y) {
+            const int* poczatki = A.poczatkiWierszy();
+            const int* kolumny = A.indeksyKolumn();
+            const double* wartosci = A.wartosci();
+            y.resize(A.wiersze());
+            for (int i = 0; i < A.wiersze(); i++) {
+                double suma = 0.0;
+                for (int p = poczatki[i]; p < poczatki[i + 1]; p++) {
+                    suma += wartosci[p] * x[kolumny[p]];
                 }
+                y[i] = suma;
             }
+        };
+    }
 
-            cout << "Macierz U po iteracji " << k+1 << ":" << endl;
-            wyswietlMacierz(U, "U (aktualna)");
-
-            cout << "Macierz L po iteracji " << k+1 << ":" << endl;
-            wyswietlMacierz(L, "L (aktualna)");
-        }
+    OperatorLiniowy operatorMacierzy(const WidokPasmowy& A) {
+        return [A](const vector<double>& x, vector<double>& y) {
+            int n = A.rozmiar();
+            y.resize(n);
+            for (int i = 0; i < n; i++) {
+                int od = max(0, i - A.dolna());
+                int doKolumny = min(n - 1, i + A.gorna());
+                y[i] = iloczynSkalarny(doKolumny - od + 1, &A(i, od), x.data() + od);
+            }
+        };
+    }
 
-        wyswietlMacierz(L, "Macierz L (końcowa)");
-        wyswietlMacierz(U, "Macierz U (końcowa)");
+    static double normaEuklidesowa(const vector<double>& v) {
+        return sqrt(iloczynSkalarny(v.size(), v.data(), v.data()));
     }
 
-    vector<double> permutujWektor(const vector<double>& b, const vector<int>& P) {
-        int n = b.size();
-        vector<double> pb(n);
+    static bool spelnione(const KryteriumZbieznosci& kryterium, double residuum, double normaB) {
+        return residuum <= kryterium.tolerancjaBezwzgledna ||
+               residuum <= kryterium.tolerancjaWzgledna * normaB;
+    }
 
-        for (int i = 0; i < n; i++) {
-            pb[i] = b[P[i]];
+    static void zglosZbieznosc([[maybe_unused]] const string& metoda, [[maybe_unused]] const RaportZbieznosci& raport) {
+        SLEDZ(komunikat(metoda + ": iteracje = " + to_string(raport.iteracje) +
+                        ", residuum = " + tekst(raport.residuum) +
+                        ", residuum względne = " + tekst(raport.residuumWzgledne)));
+        if (!raport.zbiezny) {
+            SLEDZ(ostrzezenie(metoda + ": nie osiągnięto zadanej tolerancji"));
         }
+    }
 
-        return pb;
+    using Zegar = chrono::steady_clock;
+
+    static void zakonczRaport(const string& metoda, RaportZbieznosci& raport, double normaR, double normaB,
+                              Zegar::time_point start) {
+        chrono::duration<double> czas = Zegar::now() - start;
+        raport.czasNaIteracje = raport.iteracje > 0 ? czas.count() / raport.iteracje : 0.0;
+        raport.residuum = normaR;
+        raport.residuumWzgledne = normaB > 0.0 ? normaR / normaB : normaR;
+        zglosZbieznosc(metoda, raport);
     }
 
-    vector<double> rozwiazLy_b(const vector<vector<double>>& L, const vector<double>& b) {
-        int n = L.size();
-        vector<double> y(n);
+    static Prekondycjoner prekondycjonerPrzekatnej(vector<double> przekatna) {
+        for (int i = 0; i < (int)przekatna.size(); i++) {
+            if (przekatna[i] == 0.0) {
+                throw runtime_error("Zerowy element na przekątnej w wierszu " + to_string(i + 1));
+            }
+            przekatna[i] = 1.0 / przekatna[i];
+        }
+        return [odwrotnosci = move(przekatna)](const vector<double>& r, vector<double>& z) {
+            z.resize(r.size());
+            for (size_t i = 0; i < r.size(); i++) {
+                z[i] = odwrotnosci[i] * r[i];
+            }
+        };
+    }
 
-        cout << "Ly = b" << endl;
-        for (int i = 0; i < n; i++) {
-            double suma = 0.0;
-            for (int j = 0; j < i; j++) {
-                suma += L[i][j] * y[j];
+    Prekondycjoner prekondycjonerJacobiego(const MacierzRzadkaCSR& A) {
+        vector<double> przekatna(A.wiersze(), 0.0);
+        vector<int> indeksy = A.indeksyPrzekatnej();
+        for (int i = 0; i < A.wiersze(); i++) {
+            if (indeksy[i] >= 0) {
+                przekatna[i] = A.wartosci()[indeksy[i]];
             }
-            y[i] = (b[i] - suma) / L[i][i];
         }
+        return prekondycjonerPrzekatnej(move(przekatna));
+    }
 
-        return y;
+    Prekondycjoner prekondycjonerJacobiego(const Macierz& A) {
+        vector<double> przekatna(A.wiersze());
+        for (int i = 0; i < A.wiersze(); i++) {
+            przekatna[i] = A(i, i);
+        }
+        return prekondycjonerPrzekatnej(move(przekatna));
     }
 
-    vector<double> rozwiazUx_y(const vector<vector<double>>& U, const vector<double>& y) {
-        int n = U.size();
-        vector<double> x(n);
+    Prekondycjoner prekondycjonerSSOR(const MacierzRzadkaCSR& A, double omega) {
+        if (omega <= 0.0 || omega >= 2.0) {
+            throw invalid_argument("Parametr relaksacji omega musi należeć do przedziału (0, 2)");
+        }
+        vector<int> przekatna = A.indeksyPrzekatnej();
+        for (int i = 0; i < A.wiersze(); i++) {
+            if (przekatna[i] < 0 || A.wartosci()[przekatna[i]] == 0.0) {
+                throw runtime_error("Zerowy element na przekątnej w wierszu " + to_string(i + 1));
+            }
+        }
 
-        cout << "Ux = y" << endl;
-        for (int i = n - 1; i >= 0; i--) {
-            double suma = 0.0;
-            for (int j = i + 1; j < n; j++) {
-                suma += U[i][j] * x[j];
+        // M^-1 r = omega (2 - omega) (D + omega U)^-1 D (D + omega L)^-1 r
+        return [&A, przekatna, omega](const vector<double>& r, vector<double>& z) {
+            const vector<int>& poczatki = A.poczatkiWierszy();
+            const vector<int>& kolumny = A.indeksyKolumn();
+            const vector<double>& wartosci = A.wartosci();
+            int n = A.wiersze();
+            z.resize(n);
+
+            for (int i = 0; i < n; i++) {
+                double suma = r[i];
+                for (int p = poczatki[i]; p < przekatna[i]; p++) {
+                    suma -= omega * wartosci[p] * z[kolumny[p]];
+                }
+                z[i] = suma / wartosci[przekatna[i]];
+            }
+            for (int i = 0; i < n; i++) {
+                z[i] *= wartosci[przekatna[i]];
+            }
+            for (int i = n - 1; i >= 0; i--) {
+                double suma = z[i];
+                for (int p = przekatna[i] + 1; p < poczatki[i + 1]; p++) {
+                    suma -= omega * wartosci[p] * z[kolumny[p]];
+                }
+                z[i] = suma / wartosci[przekatna[i]];
             }
-            if (fabs(U[i][i]) < 1e-10) {
-                cerr << "Wartość zbyt bliska zeru!" << endl;
-                exit(1);
+            double skala = omega * (2.0 - omega);
+            for (int i = 0; i < n; i++) {
+                z[i] *= skala;
             }
-            x[i] = (y[i] - suma) / U[i][i];
+        };
+    }
 
-            cout << n-i << ": " << x[i] << endl;
+    // IC(0) na wzorcu dolnego trojkata A (wiersze CSR, ostatni element wiersza to przekatna);
+    // zwraca false, gdy pod pierwiastkiem pojawi sie liczba niedodatnia
+    static bool rozkladCholeskyNiepelny(const vector<int>& poczatki, const vector<int>& kolumny,
+                                        vector<double>& wartosci) {
+        int n = poczatki.size() - 1;
+        for (int i = 0; i < n; i++) {
+            int przekatna_i = poczatki[i + 1] - 1;
+            for (int p = poczatki[i]; p <= przekatna_i; p++) {
+                int k = kolumny[p];
+                // suma L_ij * L_kj po wspolnych kolumnach j < k (scalanie posortowanych list)
+                double suma = 0.0;
+                int pi = poczatki[i], pk = poczatki[k];
+                while (pi < p && pk < poczatki[k + 1] - 1) {
+                    if (kolumny[pi] == kolumny[pk]) {
+                        suma += wartosci[pi++] * wartosci[pk++];
+                    } else if (kolumny[pi] < kolumny[pk]) {
+                        pi++;
+                    } else {
+                        pk++;
+                    }
+                }
+                if (k < i) {
+                    wartosci[p] = (wartosci[p] - suma) / wartosci[poczatki[k + 1] - 1];
+                } else {
+                    double d = wartosci[p] - suma;
+                    if (d <= 0.0) {
+                        return false;
+                    }
+                    wartosci[p] = sqrt(d);
+                }
+            }
         }
-
-        return x;
+        return true;
     }
 
-    double sprawdzPoprawnosc(const vector<vector<double>>& A,
-                            const vector<double>& x,
-                            const vector<double>& b) {
-        int n = A.size();
-        double maxBled = 0.0;
-
-        cout << "Sprawdzanie poprawności rozwiązania " << endl;
-        cout << "A * x = b?" << endl;
+    Prekondycjoner prekondycjonerCholeskyNiepelny(const MacierzRzadkaCSR& A) {
+        int n = A.wiersze();
+        if (A.kolumny() != n) {
+            throw invalid_argument("Macierz musi być kwadratowa");
+        }
 
+        // dolny trojkat A (z przekatna) jako osobne tablice CSR
+        vector<int> poczatki(n + 1, 0);
+        vector<int> kolumny;
+        vector<double> wartosciA;
         for (int i = 0; i < n; i++) {
-            double suma = 0.0;
-            for (int j = 0; j < n; j++) {
-                suma += A[i][j] * x[j];
+            bool jestPrzekatna = false;
+            for (int p = A.poczatkiWierszy()[i]; p < A.poczatkiWierszy()[i + 1]; p++) {
+                int j = A.indeksyKolumn()[p];
+                if (j <= i) {
+                    kolumny.push_back(j);
+                    wartosciA.push_back(A.wartosci()[p]);
+                    jestPrzekatna = jestPrzekatna || j == i;
+                }
             }
-            double blad = fabs(suma - b[i]);
-            cout << "Wiersz " << i+1 << ": " << suma << " ?= " << b[i]
-                 << " (błąd: " << blad << ")" << endl;
-
-            if (blad > maxBled) {
-                maxBled = blad;
+            if (!jestPrzekatna || wartosciA.back() <= 0.0) {
+                throw runtime_error("Macierz nie jest dodatnio określona (przekątna w wierszu " + to_string(i + 1) + ")");
             }
+            poczatki[i + 1] = kolumny.size();
         }
 
-        cout << "Maksymalny błąd: " << maxBled << endl;
+        vector<double> wartosciL = wartosciA;
+        double alfa = 0.0;
+        while (!rozkladCholeskyNiepelny(poczatki, kolumny, wartosciL)) {
+            alfa = alfa == 0.0 ? 1e-3 : 2.0 * alfa;
+            if (alfa > 1e3) {
+                throw runtime_error("Niepełny rozkład Cholesky'ego nie powiódł się");
+            }
+            wartosciL = wartosciA;
+            for (int i = 0; i < n; i++) {
+                wartosciL[poczatki[i + 1] - 1] *= 1.0 + alfa;
+            }
+        }
 
-        return maxBled;
+        return [poczatki, kolumny, wartosciL](const vector<double>& r, vector<double>& z) {
+            int n = poczatki.size() - 1;
+            z = r;
+            // L y = r
+            for (int i = 0; i < n; i++) {
+                double suma = z[i];
+                for (int p = poczatki[i]; p < poczatki[i + 1] - 1; p++) {
+                    suma -= wartosciL[p] * z[kolumny[p]];
+                }
+                z[i] = suma / wartosciL[poczatki[i + 1] - 1];
+            }
+            // L^T z = y, kolumnami L^T czyli wierszami L
+            for (int i = n - 1; i >= 0; i--) {
+                z[i] /= wartosciL[poczatki[i + 1] - 1];
+                for (int p = poczatki[i]; p < poczatki[i + 1] - 1; p++) {
+                    z[kolumny[p]] -= wartosciL[p] * z[i];
+                }
+            }
+        };
     }
 
-    pair<vector<double>, vector<double>> rozwiazUkladLU(const vector<vector<double>>& A,
-                                                        const vector<double>& b) {
-        int n = A.size();
-        vector<vector<double>> L, U;
-        vector<int> P;
-
-        rozkladLU_zPivotingiem(A, L, U, P);
+    RaportZbieznosci metodaGradientowSprzezonych(const OperatorLiniowy& A,
+                                                 const vector<double>& wektor_b,
+                                                 const vector<double>& przyblizenie_poczatkowe,
+                                                 const KryteriumZbieznosci& kryterium,
+                                                 const Prekondycjoner& M) {
+        int n = wektor_b.size();
+        if (n == 0 || przyblizenie_poczatkowe.size() != n) {
+            throw invalid_argument("Nieprawidłowe wymiary");
+        }
 
-        vector<double> pb = permutujWektor(b, P);
-        wyswietlWektor(pb, "Permutowany wektor b");
+        Zegar::time_point start = Zegar::now();
+        RaportZbieznosci raport;
+        raport.x = przyblizenie_poczatkowe;
+        vector<double>& x = raport.x;
 
-        vector<double> y = rozwiazLy_b(L, pb);
+        vector<double> r(n), z(n), p(n), Ap(n);
+        A(x, Ap);
+        for (int i = 0; i < n; i++) {
+            r[i] = wektor_b[i] - Ap[i];
+        }
 
-        vector<double> x = rozwiazUx_y(U, y);
+        double normaB = normaEuklidesowa(wektor_b);
+        double normaR = normaEuklidesowa(r);
+        raport.historiaResiduum.push_back(normaR);
 
-        return make_pair(y, x);
-    }
-    void utworzMacierzDopelniona(const vector<vector<double>>& A, const vector<double>& B, vector<vector<double>>& macierzDopelniona) {
-        int N = A.size();
-        macierzDopelniona.resize(N, vector<double>(N + 1, 0));
-        //macierz dopelniona ma o 1 wiecej kolumn, ostatnia kolumna to wyrazy wolne
+        if (M) M(r, z); else z = r;
+        p = z;
+        double rz = iloczynSkalarny(n, r.data(), z.data());
 
-        for (int i = 0; i < N; i++) {
-            for (int j = 0; j < N; j++) {
-                macierzDopelniona[i][j] = A[i][j];
+        while (!(raport.zbiezny = spelnione(kryterium, normaR, normaB)) && raport.iteracje < kryterium.max_iteracji) {
+            A(p, Ap);
+            double pAp = iloczynSkalarny(n, p.data(), Ap.data());
+            if (pAp <= 0.0) {
+                break;      // operator nie jest dodatnio okreslony
             }
-            macierzDopelniona[i][N] = B[i];             //dodawanie wyrazow wolnych do ostatniej koluny
-        }
-    }
-    void wyswietlMacierz(const vector<vector<double>>& macierz, const string& nazwa) {
-        cout << nazwa << ":" << endl;
-        for (const auto& wiersz : macierz) {
-            for (double element : wiersz) {
-                cout << setw(10) << fixed << setprecision(4) << element << " ";
+            double alfa = rz / pAp;
+            axpy(n, alfa, p.data(), x.data());
+            axpy(n, -alfa, Ap.data(), r.data());
+            raport.iteracje++;
+
+            normaR = normaEuklidesowa(r);
+            raport.historiaResiduum.push_back(normaR);
+
+            if (M) M(r, z); else z = r;
+            double rz_nowe = iloczynSkalarny(n, r.data(), z.data());
+            double beta = rz_nowe / rz;
+            rz = rz_nowe;
+            for (int i = 0; i < n; i++) {
+                p[i] = z[i] + beta * p[i];
             }
-            cout << endl;
         }
-        cout << endl;
+
+        zakonczRaport("Metoda gradientów sprzężonych", raport, normaR, normaB, start);
+        return raport;
     }
-    void wyswietlWektor(const vector<double>& wektor, const string& nazwa) {
-        cout << nazwa << ":" << endl;
-        for (double element : wektor) {
-            cout << setw(10) << fixed << setprecision(4) << element << " ";
+
+    RaportZbieznosci metodaGradientowSprzezonych(const MacierzRzadkaCSR& A,
+                                                 const vector<double>& wektor_b,
+                                                 const vector<double>& przyblizenie_poczatkowe,
+                                                 const KryteriumZbieznosci& kryterium,
+                                                 const Prekondycjoner& M) {
+        if (A.wiersze() != A.kolumny() || A.wiersze() != wektor_b.size()) {
+            throw invalid_argument("Nieprawidłowe wymiary");
         }
-        cout << endl << endl;
+        return metodaGradientowSprzezonych(operatorMacierzy(A), wektor_b, przyblizenie_poczatkowe, kryterium, M);
     }
-    void sprawdzWynik(const vector<vector<double>>& A, const vector<double>& B, const vector<double>& X) {
-    int N = A.size();
-    cout << "sprawdzanie wynikow: :" << endl;
 
-    for (int i = 0; i < N; i++) {
-        double suma = 0;
-        for (int j = 0; j < N; j++) {
-            suma += A[i][j] * X[j];
+    RaportZbieznosci metodaGradientowSprzezonych(const Macierz& A,
+                                                 const vector<double>& wektor_b,
+                                                 const vector<double>& przyblizenie_poczatkowe,
+                                                 const KryteriumZbieznosci& kryterium,
+                                                 const Prekondycjoner& M) {
+        if (A.wiersze() != A.kolumny() || A.wiersze() != wektor_b.size()) {
+            throw invalid_argument("Nieprawidłowe wymiary");
         }
-        cout << "Równanie " << i+1 << ": ";
-        cout << suma << " w przyblizeniu rowne: " << B[i] << endl;
+        return metodaGradientowSprzezonych(operatorMacierzy(A), wektor_b, przyblizenie_poczatkowe, kryterium, M);
     }
-    cout << endl;
-}
-void sprowadzanieDoPostaciSchodkowej(vector<vector<double>>& macierzDopelniona) {
-    int N = macierzDopelniona.size();
 
-    for (int i = 0; i < N; i++) {
-        if (fabs(macierzDopelniona[i][i]) < 1e-10) {                // element na przekatnej jest rowny 0 (w tym przypadku skorzystalem z precyzji)
-            int indeksMax = i;
-            double wartoscMax = fabs(macierzDopelniona[i][i]);
+    static void sprawdzWymiaryOperatora(int wiersze, int kolumny, const vector<double>& wektor_b) {
+        if (wiersze != kolumny || wiersze != (int)wektor_b.size()) {
+            throw invalid_argument("Nieprawidłowe wymiary");
+        }
+    }
 
-            for (int j = i + 1; j < N; j++) {                           // szukanie elementu o najwiekszym module w kolumne gdzie 0 jest na przekatnej macierzy
-                if (fabs(macierzDopelniona[j][i]) > wartoscMax) {
-                    indeksMax = j;
-                    wartoscMax = fabs(macierzDopelniona[j][i]);
-                }
-            }
+    // residuum b - A x i jego norma
+    static double residuumOperatora(const OperatorLiniowy& A, const vector<double>& wektor_b,
+                                    const vector<double>& x, vector<double>& r) {
+        A(x, r);
+        for (size_t i = 0; i < r.size(); i++) {
+            r[i] = wektor_b[i] - r[i];
+        }
+        return normaEuklidesowa(r);
+    }
 
-            if (indeksMax != i) {
-                cout << "Pivoting: zamiana wierszy " << i+1 << " i " << indeksMax+1 << endl;
-                macierzDopelniona[i].swap(macierzDopelniona[indeksMax]);
-            }
+    // obrot Givensa [c s; -s c] zerujacy b w wektorze (a, b)
+    static void obrotGivensa(double a, double b, double& c, double& s) {
+        if (b == 0.0) {
+            c = 1.0;
+            s = 0.0;
+        } else {
+            double r = hypot(a, b);
+            c = a / r;
+            s = b / r;
         }
+    }
 
-        if (fabs(macierzDopelniona[i][i]) < 1e-10) { //jesli na przekatnej sa 0 to brak rozwiazan
-            cout << "brak rozwiazan!" << endl;
-            continue;
+    RaportZbieznosci metodaGMRES(const OperatorLiniowy& A,
+                                 const vector<double>& wektor_b,
+                                 const vector<double>& przyblizenie_poczatkowe,
+                                 int restart,
+                                 const KryteriumZbieznosci& kryterium,
+                                 const Prekondycjoner& M) {
+        int n = wektor_b.size();
+        if (n == 0 || przyblizenie_poczatkowe.size() != n) {
+            throw invalid_argument("Nieprawidłowe wymiary");
+        }
+        if (restart < 1) {
+            throw invalid_argument("Długość cyklu GMRES musi być dodatnia");
         }
+        int m = min(restart, n);
 
+        Zegar::time_point start = Zegar::now();
+        RaportZbieznosci raport;
+        raport.x = przyblizenie_poczatkowe;
+        vector<double>& x = raport.x;
 
-        for (int j = i + 1; j < N; j++) {
-            double mnoznnik = macierzDopelniona[j][i] / macierzDopelniona[i][i];                //zerowanie elementow ponizej przekatnej
-            for (int k = i; k <= N; k++) {
-                macierzDopelniona[j][k] -= mnoznnik * macierzDopelniona[i][k];
-            }
-        }
+        // baza Kryłowa V (m + 1 wektorow) i macierz Hessenberga H ((m + 1) x m) - pamiec O(m n)
+        vector<vector<double>> V(m + 1, vector<double>(n));
+        Macierz H(m + 1, m);
+        vector<double> cs(m), sn(m), g(m + 1), w(n), z(n), y(m);
+
+        double normaB = normaEuklidesowa(wektor_b);
+        double normaR = residuumOperatora(A, wektor_b, x, V[0]);
+        raport.historiaResiduum.push_back(normaR);
 
-        cout << "Po eliminacji dla wiersza " << i+1 << ":" << endl;                                    //wyswietlanie macierzy co iteracje po wyzerowaniu kolumny ponizej przekatnej
-        for (int r = 0; r < N; r++) {
-            for (int c = 0; c <= N; c++) {
-                cout << setw(10) << fixed << setprecision(4) << macierzDopelniona[r][c] << " ";
+        while (!(raport.zbiezny = spelnione(kryterium, normaR, normaB)) && raport.iteracje < kryterium.max_iteracji) {
+            for (int i = 0; i < n; i++) {
+                V[0][i] /= normaR;
+            }
+            fill(g.begin(), g.end(), 0.0);
+            g[0] = normaR;
+
+            int j = 0;
+            for (; j < m && raport.iteracje < kryterium.max_iteracji; j++) {
+                // w = A M^-1 v_j (prekondycjonowanie prawostronne), ortogonalizacja zmodyfikowana Grama-Schmidta
+                if (M) M(V[j], z); else z = V[j];
+                A(z, w);
+                for (int i = 0; i <= j; i++) {
+                    H(i, j) = iloczynSkalarny(n, w.data(), V[i].data());
+                    axpy(n, -H(i, j), V[i].data(), w.data());
+                }
+                H(j + 1, j) = normaEuklidesowa(w);
+                if (H(j + 1, j) != 0.0) {
+                    for (int i = 0; i < n; i++) {
+                        V[j + 1][i] = w[i] / H(j + 1, j);
+                    }
+                }
+
+                for (int i = 0; i < j; i++) {
+                    double h = cs[i] * H(i, j) + sn[i] * H(i + 1, j);
+                    H(i + 1, j) = -sn[i] * H(i, j) + cs[i] * H(i + 1, j);
+                    H(i, j) = h;
+                }
+                obrotGivensa(H(j, j), H(j + 1, j), cs[j], sn[j]);
+                H(j, j) = cs[j] * H(j, j) + sn[j] * H(j + 1, j);
+                H(j + 1, j) = 0.0;
+                g[j + 1] = -sn[j] * g[j];
+                g[j] = cs[j] * g[j];
+
+                raport.iteracje++;
+                normaR = fabs(g[j + 1]);
+                raport.historiaResiduum.push_back(normaR);
+                if (spelnione(kryterium, normaR, normaB)) {
+                    j++;
+                    break;
+                }
+            }
+
+            // H y = g (trojkatna gorna j x j), x += M^-1 V y
+            for (int i = j - 1; i >= 0; i--) {
+                double suma = g[i];
+                for (int k = i + 1; k < j; k++) {
+                    suma -= H(i, k) * y[k];
+                }
+                y[i] = suma / H(i, i);
+            }
+            fill(w.begin(), w.end(), 0.0);
+            for (int i = 0; i < j; i++) {
+                axpy(n, y[i], V[i].data(), w.data());
+            }
+            if (M) M(w, z); else z = w;
+            axpy(n, 1.0, z.data(), x.data());
+
+            // prawdziwe residuum na poczatku nowego cyklu (oszacowanie |g| moze odbiegac)
+            normaR = residuumOperatora(A, wektor_b, x, V[0]);
+            raport.historiaResiduum.back() = normaR;
+            if (normaR == 0.0) {
+                break;
+            }
+        }
+        raport.zbiezny = spelnione(kryterium, normaR, normaB);
+
+        zakonczRaport("GMRES", raport, normaR, normaB, start);
+        return raport;
+    }
+
+    RaportZbieznosci metodaGMRES(const MacierzRzadkaCSR& A,
+                                 const vector<double>& wektor_b,
+                                 const vector<double>& przyblizenie_poczatkowe,
+                                 int restart,
+                                 const KryteriumZbieznosci& kryterium,
+                                 const Prekondycjoner& M) {
+        sprawdzWymiaryOperatora(A.wiersze(), A.kolumny(), wektor_b);
+        return metodaGMRES(operatorMacierzy(A), wektor_b, przyblizenie_poczatkowe, restart, kryterium, M);
+    }
+
+    RaportZbieznosci metodaGMRES(const Macierz& A,
+                                 const vector<double>& wektor_b,
+                                 const vector<double>& przyblizenie_poczatkowe,
+                                 int restart,
+                                 const KryteriumZbieznosci& kryterium,
+                                 const Prekondycjoner& M) {
+        sprawdzWymiaryOperatora(A.wiersze(), A.kolumny(), wektor_b);
+        return metodaGMRES(operatorMacierzy(A), wektor_b, przyblizenie_poczatkowe, restart, kryterium, M);
+    }
+
+    RaportZbieznosci metodaBiCGSTAB(const OperatorLiniowy& A,
+                                    const vector<double>& wektor_b,
+                                    const vector<double>& przyblizenie_poczatkowe,
+                                    const KryteriumZbieznosci& kryterium,
+                                    const Prekondycjoner& M) {
+        int n = wektor_b.size();
+        if (n == 0 || przyblizenie_poczatkowe.size() != n) {
+            throw invalid_argument("Nieprawidłowe wymiary");
+        }
+
+        Zegar::time_point start = Zegar::now();
+        RaportZbieznosci raport;
+        raport.x = przyblizenie_poczatkowe;
+        vector<double>& x = raport.x;
+
+        vector<double> r(n), r0(n), p(n, 0.0), v(n, 0.0), s(n), t(n), p_dasz(n), s_dasz(n);
+        double normaB = normaEuklidesowa(wektor_b);
+        double normaR = residuumOperatora(A, wektor_b, x, r);
+        raport.historiaResiduum.push_back(normaR);
+        r0 = r;
+
+        double rho = 1.0, alfa = 1.0, omega = 1.0;
+        while (!(raport.zbiezny = spelnione(kryterium, normaR, normaB)) && raport.iteracje < kryterium.max_iteracji) {
+            double rho_nowe = iloczynSkalarny(n, r0.data(), r.data());
+            if (rho_nowe == 0.0 || omega == 0.0) {
+                SLEDZ(ostrzezenie("BiCGSTAB: załamanie metody (rho = " + tekst(rho_nowe) +
+                                  ", omega = " + tekst(omega) + ")"));
+                break;
+            }
+            double beta = (rho_nowe / rho) * (alfa / omega);
+            rho = rho_nowe;
+            for (int i = 0; i < n; i++) {
+                p[i] = r[i] + beta * (p[i] - omega * v[i]);
+            }
+
+            if (M) M(p, p_dasz); else p_dasz = p;
+            A(p_dasz, v);
+            double r0v = iloczynSkalarny(n, r0.data(), v.data());
+            if (r0v == 0.0) {
+                SLEDZ(ostrzezenie("BiCGSTAB: załamanie metody (r0^T v = 0)"));
+                break;
+            }
+            alfa = rho / r0v;
+            for (int i = 0; i < n; i++) {
+                s[i] = r[i] - alfa * v[i];
+            }
+            raport.iteracje++;
+
+            double normaS = normaEuklidesowa(s);
+            if (spelnione(kryterium, normaS, normaB)) {
+                axpy(n, alfa, p_dasz.data(), x.data());
+                r = s;
+                normaR = normaS;
+                raport.historiaResiduum.push_back(normaR);
+                continue;
+            }
+
+            if (M) M(s, s_dasz); else s_dasz = s;
+            A(s_dasz, t);
+            double tt = iloczynSkalarny(n, t.data(), t.data());
+            omega = tt > 0.0 ? iloczynSkalarny(n, t.data(), s.data()) / tt : 0.0;
+            axpy(n, alfa, p_dasz.data(), x.data());
+            axpy(n, omega, s_dasz.data(), x.data());
+            for (int i = 0; i < n; i++) {
+                r[i] = s[i] - omega * t[i];
+            }
+            normaR = normaEuklidesowa(r);
+            raport.historiaResiduum.push_back(normaR);
+        }
+
+        zakonczRaport("BiCGSTAB", raport, normaR, normaB, start);
+        return raport;
+    }
+
+    RaportZbieznosci metodaBiCGSTAB(const MacierzRzadkaCSR& A,
+                                    const vector<double>& wektor_b,
+                                    const vector<double>& przyblizenie_poczatkowe,
+                                    const KryteriumZbieznosci& kryterium,
+                                    const Prekondycjoner& M) {
+        sprawdzWymiaryOperatora(A.wiersze(), A.kolumny(), wektor_b);
+        return metodaBiCGSTAB(operatorMacierzy(A), wektor_b, przyblizenie_poczatkowe, kryterium, M);
+    }
+
+    RaportZbieznosci metodaBiCGSTAB(const Macierz& A,
+                                    const vector<double>& wektor_b,
+                                    const vector<double>& przyblizenie_poczatkowe,
+                                    const KryteriumZbieznosci& kryterium,
+                                    const Prekondycjoner& M) {
+        sprawdzWymiaryOperatora(A.wiersze(), A.kolumny(), wektor_b);
+        return metodaBiCGSTAB(operatorMacierzy(A), wektor_b, przyblizenie_poczatkowe, kryterium, M);
+    }
+
+    RaportZbieznosci metodaSOR(const MacierzRzadkaCSR& macierz_A,
+                               const vector<double>& wektor_b,
+                               const vector<double>& przyblizenie_poczatkowe,
+                               double omega,
+                               const KryteriumZbieznosci& kryterium) {
+        if (omega <= 0.0 || omega >= 2.0) {
+            throw invalid_argument("Parametr relaksacji omega musi należeć do przedziału (0, 2)");
+        }
+        vector<int> przekatna = przekatnaDoIteracji(macierz_A, wektor_b, przyblizenie_poczatkowe);
+
+        Zegar::time_point start = Zegar::now();
+        RaportZbieznosci raport;
+        raport.x = przyblizenie_poczatkowe;
+        double normaB = normaEuklidesowa(wektor_b);
+        double kwadratResiduum;
+        double normaR = INFINITY;
+
+        while (raport.iteracje < kryterium.max_iteracji) {
+            double norma_kroku = przebiegSOR(macierz_A, wektor_b, przekatna, omega, raport.x, kwadratResiduum);
+            // residuum z przebiegu dotyczy przyblizenia sprzed aktualizacji kolejnych wierszy
+            normaR = sqrt(kwadratResiduum);
+            raport.historiaResiduum.push_back(normaR);
+            raport.iteracje++;
+            if ((raport.zbiezny = spelnione(kryterium, normaR, normaB) || norma_kroku < kryterium.tolerancjaKroku)) {
+                break;
+            }
+        }
+
+        vector<double> r(macierz_A.wiersze());
+        normaR = residuumOperatora(operatorMacierzy(macierz_A), wektor_b, raport.x, r);
+        zakonczRaport(omega == 1.0 ? "Gauss-Seidel" : "SOR", raport, normaR, normaB, start);
+        return raport;
+    }
+
+    RaportZbieznosci metodaGaussaSeidela(const MacierzRzadkaCSR& macierz_A,
+                                         const vector<double>& wektor_b,
+                                         const vector<double>& przyblizenie_poczatkowe,
+                                         const KryteriumZbieznosci& kryterium) {
+        return metodaSOR(macierz_A, wektor_b, przyblizenie_poczatkowe, 1.0, kryterium);
+    }
+
+    // przebieg SOR dla macierzy gestej; residuum wiersza i dla biezacego x to r_i = a_ii * (x_gs_i - x_i)
+    static double przebiegSORGesty(const Macierz& A, const vector<double>& wektor_b, double omega,
+                                   vector<double>& x, double& kwadratResiduum) {
+        int n = A.wiersze();
+        double norma_kroku = 0.0;
+        kwadratResiduum = 0.0;
+        for (int i = 0; i < n; i++) {
+            const double* wiersz_i = A.wiersz(i);
+            double r_i = wektor_b[i] - iloczynSkalarny(n, wiersz_i, x.data());
+            double krok = omega * r_i / wiersz_i[i];
+            x[i] += krok; // Aktualizuj od razu (różnica od Jacobiego)
+            norma_kroku += fabs(krok);
+            kwadratResiduum += r_i * r_i;
+        }
+        return norma_kroku;
+    }
+
+    static void sprawdzPrzekatnaGesta(const Macierz& macierz_A, const vector<double>& wektor_b,
+                                      const vector<double>& przyblizenie_poczatkowe) {
+        int n = macierz_A.wiersze();
+        if (n == 0 || macierz_A.kolumny() != n || wektor_b.size() != n || przyblizenie_poczatkowe.size() != n) {
+            throw invalid_argument("Nieprawidłowe wymiary");
+        }
+        for (int i = 0; i < n; i++) {
+            if (macierz_A(i, i) == 0.0) {
+                throw runtime_error("Zerowy element na przekątnej w wierszu " + to_string(i + 1));
+            }
+        }
+    }
+
+    RaportZbieznosci metodaGaussaSeidela(const Macierz& macierz_A,
+                                         const vector<double>& wektor_b,
+                                         const vector<double>& przyblizenie_poczatkowe,
+                                         const KryteriumZbieznosci& kryterium) {
+        sprawdzPrzekatnaGesta(macierz_A, wektor_b, przyblizenie_poczatkowe);
+        int n = macierz_A.wiersze();
+
+        Zegar::time_point start = Zegar::now();
+        RaportZbieznosci raport;
+        raport.x = przyblizenie_poczatkowe;
+        vector<double>& x = raport.x;
+        double normaB = normaEuklidesowa(wektor_b);
+        double normaR = INFINITY;
+
+        while (raport.iteracje < kryterium.max_iteracji) {
+            double kwadratResiduum;
+            double norma_kroku = przebiegSORGesty(macierz_A, wektor_b, 1.0, x, kwadratResiduum);
+            normaR = sqrt(kwadratResiduum);
+            raport.historiaResiduum.push_back(normaR);
+            raport.iteracje++;
+            if ((raport.zbiezny = spelnione(kryterium, normaR, normaB) || norma_kroku < kryterium.tolerancjaKroku)) {
+                break;
+            }
+        }
+
+        vector<double> r(n);
+        normaR = residuumOperatora(operatorMacierzy(macierz_A), wektor_b, x, r);
+        zakonczRaport("Gauss-Seidel", raport, normaR, normaB, start);
+        return raport;
+    }
+
+    RaportZbieznosci metodaGaussaSeidela(const vector<vector<double>>& macierz_A,
+                                         const vector<double>& wektor_b,
+                                         const vector<double>& przyblizenie_poczatkowe,
+                                         const KryteriumZbieznosci& kryterium) {
+        if (macierz_A.empty()) {
+            throw invalid_argument("Nieprawidłowe wymiary");
+        }
+        return metodaGaussaSeidela(Macierz(macierz_A), wektor_b, przyblizenie_poczatkowe, kryterium);
+    }
+
+    // optymalne omega dla macierzy zgodnie uporzadkowanych: rho_GS = rho_J^2, omega = 2 / (1 + sqrt(1 - rho_J^2))
+    static double omegaOptymalne(double rhoJ2) {
+        rhoJ2 = min(max(rhoJ2, 0.0), 0.9999);
+        return 2.0 / (1.0 + sqrt(1.0 - rhoJ2));
+    }
+
+    // SOR z doborem omega: najpierw przebiegi Gaussa-Seidela do ustalenia sie ilorazu kolejnych
+    // norm kroku (-> rho_GS), potem SOR z omega optymalnym dla tego oszacowania; po zmianie omega
+    // i `okno` przebiegach przejsciowych srednia zbieznosc lambda z kolejnych `okno` przebiegow
+    // jest porownywana z omega - 1 (dla omega >= optymalnego |lambda| = omega - 1); jesli
+    // lambda > sqrt(omega - 1), omega jest za male i rho_J^2 jest szacowane ponownie
+    // z (lambda + omega - 1)^2 = lambda omega^2 rho_J^2 (test w stylu Hagemana-Younga)
+    template <typename Przebieg>
+    static RaportSOR sorAdaptacyjny(Przebieg przebieg, const vector<double>& wektor_b,
+                                    const vector<double>& przyblizenie_poczatkowe,
+                                    const KryteriumZbieznosci& kryterium) {
+        const int okno = 20;
+        const int maxRozruch = 30;
+
+        RaportSOR raport;
+        raport.x = przyblizenie_poczatkowe;
+        double normaB = normaEuklidesowa(wektor_b);
+        double normaR = INFINITY;
+
+        double omega = 1.0;
+        bool rozruch = true;
+        double poprzedniKrok = 0.0, poprzedniIloraz = 0.0;
+        double krokNaPoczatkuOkna = 0.0;
+        int poczatekOkna = 0;
+
+        while (raport.iteracje < kryterium.max_iteracji) {
+            double kwadratResiduum;
+            double norma_kroku = przebieg(omega, raport.x, kwadratResiduum);
+            normaR = sqrt(kwadratResiduum);
+            raport.historiaResiduum.push_back(normaR);
+            raport.historiaOmega.push_back(omega);
+            raport.iteracje++;
+            if ((raport.zbiezny = spelnione(kryterium, normaR, normaB) || norma_kroku < kryterium.tolerancjaKroku)) {
+                break;
+            }
+
+            if (rozruch) {
+                double iloraz = poprzedniKrok > 0.0 ? norma_kroku / poprzedniKrok : 0.0;
+                bool ustalony = raport.iteracje >= 4 && fabs(iloraz - poprzedniIloraz) < 1e-3 * iloraz;
+                if (iloraz > 0.0 && iloraz < 1.0 && (ustalony || raport.iteracje >= maxRozruch)) {
+                    omega = omegaOptymalne(iloraz);
+                    rozruch = false;
+                    poczatekOkna = raport.iteracje;
+                    krokNaPoczatkuOkna = 0.0;
+                    SLEDZ(komunikat("SOR: rho_GS ~ " + tekst(iloraz) + ", omega = " + tekst(omega)));
+                }
+                poprzedniIloraz = iloraz;
+            } else if (raport.iteracje == poczatekOkna + okno) {
+                krokNaPoczatkuOkna = norma_kroku;      // pierwsze przebiegi po zmianie omega to stan przejsciowy
+            } else if (raport.iteracje == poczatekOkna + 2 * okno && krokNaPoczatkuOkna > 0.0) {
+                double lambda = pow(norma_kroku / krokNaPoczatkuOkna, 1.0 / okno);
+                if (lambda < 1.0 && lambda > sqrt(omega - 1.0)) {
+                    double rhoJ2 = (lambda + omega - 1.0) * (lambda + omega - 1.0) / (lambda * omega * omega);
+                    double noweOmega = omegaOptymalne(rhoJ2);
+                    if (noweOmega > omega) {
+                        omega = noweOmega;
+                        SLEDZ(komunikat("SOR: lambda = " + tekst(lambda) + ", nowe omega = " + tekst(omega)));
+                    }
+                }
+                poczatekOkna = raport.iteracje;
+            }
+            poprzedniKrok = norma_kroku;
+        }
+
+        raport.omega = omega;
+        raport.residuum = normaR;
+        raport.residuumWzgledne = normaB > 0.0 ? normaR / normaB : normaR;
+        return raport;
+    }
+
+    RaportSOR metodaSORAdaptacyjna(const MacierzRzadkaCSR& macierz_A,
+                                   const vector<double>& wektor_b,
+                                   const vector<double>& przyblizenie_poczatkowe,
+                                   const KryteriumZbieznosci& kryterium) {
+        vector<int> przekatna = przekatnaDoIteracji(macierz_A, wektor_b, przyblizenie_poczatkowe);
+        Zegar::time_point start = Zegar::now();
+        RaportSOR raport = sorAdaptacyjny(
+            [&](double omega, vector<double>& x, double& kwadratResiduum) {
+                return przebiegSOR(macierz_A, wektor_b, przekatna, omega, x, kwadratResiduum);
+            },
+            wektor_b, przyblizenie_poczatkowe, kryterium);
+
+        vector<double> r(macierz_A.wiersze());
+        double normaR = residuumOperatora(operatorMacierzy(macierz_A), wektor_b, raport.x, r);
+        zakonczRaport("SOR (adaptacyjne omega)", raport, normaR, normaEuklidesowa(wektor_b), start);
+        return raport;
+    }
+
+    RaportSOR metodaSORAdaptacyjna(const Macierz& macierz_A,
+                                   const vector<double>& wektor_b,
+                                   const vector<double>& przyblizenie_poczatkowe,
+                                   const KryteriumZbieznosci& kryterium) {
+        sprawdzPrzekatnaGesta(macierz_A, wektor_b, przyblizenie_poczatkowe);
+        Zegar::time_point start = Zegar::now();
+        RaportSOR raport = sorAdaptacyjny(
+            [&](double omega, vector<double>& x, double& kwadratResiduum) {
+                return przebiegSORGesty(macierz_A, wektor_b, omega, x, kwadratResiduum);
+            },
+            wektor_b, przyblizenie_poczatkowe, kryterium);
+
+        vector<double> r(macierz_A.wiersze());
+        double normaR = residuumOperatora(operatorMacierzy(macierz_A), wektor_b, raport.x, r);
+        zakonczRaport("SOR (adaptacyjne omega)", raport, normaR, normaEuklidesowa(wektor_b), start);
+        return raport;
+    }
+
+    // parser tekstu ukladu: liczby czytane przez from_chars prosto z pamieci pliku
+    namespace {
+        class ParserUkladu {
+        public:
+            ParserUkladu(string_view tekst, const string& nazwa)
+                : p_(tekst.data()), koniec_(tekst.data() + tekst.size()), nazwa_(nazwa) {}
+
+            // pomija spacje, tabulatory i \r; znaki nowej linii tylko gdy przezLinie
+            void pominBiale(bool przezLinie = true) {
+                while (p_ < koniec_ && (*p_ == ' ' || *p_ == '\t' || *p_ == '\r' || (przezLinie && *p_ == '\n'))) {
+                    if (*p_ == '\n') linia_++;
+                    p_++;
+                }
+            }
+
+            // szuka etykiety (np. "N:") na poczatku kolejnych linii, bez rozrozniania wielkosci liter
+            void etykieta(const char* nazwa) {
+                size_t dlugosc = strlen(nazwa);
+                while (true) {
+                    pominBiale();
+                    if (p_ >= koniec_) {
+                        blad(string("brak etykiety \"") + nazwa + "\"");
+                    }
+                    if ((size_t)(koniec_ - p_) >= dlugosc && pasujeEtykieta(nazwa, dlugosc)) {
+                        p_ += dlugosc;
+                        return;
+                    }
+                    if (strcmp(nazwa, "N:") != 0) {
+                        blad(string("oczekiwano etykiety \"") + nazwa + "\", znaleziono \"" + slowo() + "\"");
+                    }
+                    // przed "N:" moga byc inne linie naglowka (np. "l.p.: 8") - pomijamy je
+                    while (p_ < koniec_ && *p_ != '\n') p_++;
+                }
+            }
+
+            double liczba(bool przezLinie = true) {
+                pominBiale(przezLinie);
+                if (p_ >= koniec_ || *p_ == '\n') {
+                    blad("oczekiwano liczby, znaleziono koniec " + string(p_ >= koniec_ ? "pliku" : "linii"));
+                }
+                const char* poczatek = p_ < koniec_ && *p_ == '+' ? p_ + 1 : p_;
+                double wartosc;
+                from_chars_result wynik = from_chars(poczatek, koniec_, wartosc);
+                if (wynik.ec != errc() || (wynik.ptr < koniec_ && !isspace((unsigned char)*wynik.ptr))) {
+                    blad("oczekiwano liczby, znaleziono \"" + slowo() + "\"");
+                }
+                p_ = wynik.ptr;
+                return wartosc;
+            }
+
+            // po ostatniej liczbie w wierszu moga byc tylko biale znaki
+            void koniecLinii(const string& opis) {
+                pominBiale(false);
+                if (p_ < koniec_ && *p_ != '\n') {
+                    blad(opis + " zawiera więcej liczb niż oczekiwano (\"" + slowo() + "\")");
+                }
+            }
+
+            int linia() const { return linia_; }
+
+            [[noreturn]] void blad(const string& komunikat) const {
+                throw runtime_error(nazwa_ + ":" + to_string(linia_) + ": " + komunikat);
+            }
+
+        private:
+            bool pasujeEtykieta(const char* nazwa, size_t dlugosc) const {
+                for (size_t i = 0; i < dlugosc; i++) {
+                    if (tolower((unsigned char)p_[i]) != tolower((unsigned char)nazwa[i])) return false;
+                }
+                return true;
+            }
+
+            string slowo() const {
+                const char* k = p_;
+                while (k < koniec_ && !isspace((unsigned char)*k) && k - p_ < 32) k++;
+                return string(p_, k);
+            }
+
+            const char* p_;
+            const char* koniec_;
+            string nazwa_;
+            int linia_ = 1;
+        };
+    }
+
+    void wczytajDaneMapowane(const string& nazwaPliku, Macierz& A, vector<double>& B, int& N) {
+        PlikMapowany plik(nazwaPliku);
+        ParserUkladu parser(plik.tekst(), nazwaPliku);
+
+        parser.etykieta("N:");
+        double n = parser.liczba();
+        if (n < 1 || n != floor(n) || n > numeric_limits<int>::max()) {
+            parser.blad("nieprawidłowa liczba niewiadomych N = " + tekst(n));
+        }
+        int rozmiar = static_cast<int>(n);
+
+        vector<double> b(rozmiar);
+        parser.etykieta("b:");
+        for (int i = 0; i < rozmiar; i++) {
+            b[i] = parser.liczba();
+        }
+        parser.koniecLinii("wektor b");
+
+        Macierz macierz(rozmiar, rozmiar);
+        parser.etykieta("a:");
+        parser.koniecLinii("linia etykiety A");
+        for (int i = 0; i < rozmiar; i++) {
+            parser.pominBiale();
+            double* wiersz_i = macierz.wiersz(i);
+            for (int j = 0; j < rozmiar; j++) {
+                wiersz_i[j] = parser.liczba(false);     // wiersz macierzy musi lezec w jednej linii
+            }
+            parser.koniecLinii("wiersz " + to_string(i + 1) + " macierzy A");
+        }
+
+        A = move(macierz);
+        B = move(b);
+        N = rozmiar;
+    }
+
+    void wczytajDane(const string& nazwaPliku, Macierz& A, vector<double>& B, int& N) {
+        // plik szukany takze katalog wyzej (uruchamianie z katalogu budowania)
+        string sciezka = nazwaPliku;
+        if (!ifstream(sciezka)) {
+            sciezka = "../" + nazwaPliku;
+            if (!ifstream(sciezka)) {
+                cerr << "Nie można otworzyć pliku: " << nazwaPliku << endl;
+                return;
+            }
+        }
+        wczytajDaneMapowane(sciezka, A, B, N);
+    }
+
+    void wczytajDane(const string& nazwaPliku, vector<vector<double>>& A, vector<double>& B, int& N) {
+        Macierz M;
+        wczytajDane(nazwaPliku, M, B, N);
+        if (!M.pusta()) {
+            A = M.doWektorow();
+        }
+    }
+
+    void rozkladLU_zPivotingiem(const Macierz& A,
+                               Macierz& L,
+                               Macierz& U,
+                               vector<int>& P) {
+        int n = A.wiersze();
+
+        U = A;
+        L = Macierz::jednostkowa(n);
+        P.resize(n);
+
+        for (int i = 0; i < n; i++) {
+            P[i] = i;
+        }
+
+        for (int k = 0; k < n; k++) {
+            SLEDZ(komunikat("Iteracja " + to_string(k+1)));
+
+            double max_val = 0.0;
+            int max_idx = k;
+
+            for (int i = k; i < n; i++) {
+                double abs_val = fabs(U(i, k));
+                if (abs_val > max_val) {
+                    max_val = abs_val;
+                    max_idx = i;
+                }
+            }
+            if (max_val < 1e-10) {
+                SLEDZ(ostrzezenie("Macierz jest osobliwa!"));
+            }
+
+            if (max_idx != k) {
+                SLEDZ(komunikat("Zamiana wierszy: " + to_string(k+1) + " i " + to_string(max_idx+1)));
+
+                swap(P[k], P[max_idx]);
+                U.zamienWiersze(k, max_idx);
+
+                for (int j = 0; j < k; j++) {
+                    swap(L(k, j), L(max_idx, j));
+                }
+            }
+
+            const double* wiersz_k = U.wiersz(k);
+            for (int i = k + 1; i < n; i++) {
+                double* wiersz_i = U.wiersz(i);
+                L(i, k) = wiersz_i[k] / wiersz_k[k];
+
+                axpy(n - k, -L(i, k), wiersz_k + k, wiersz_i + k);
+            }
+
+            SLEDZ(komunikat("Macierz U po iteracji " + to_string(k+1) + ":"));
+            SLEDZ(macierz(U, "U (aktualna)"));
+
+            SLEDZ(komunikat("Macierz L po iteracji " + to_string(k+1) + ":"));
+            SLEDZ(macierz(L, "L (aktualna)"));
+        }
+
+        SLEDZ(macierz(L, "Macierz L (końcowa)"));
+        SLEDZ(macierz(U, "Macierz U (końcowa)"));
+    }
+
+    void rozkladLU_zPivotingiem(const vector<vector<double>>& A,
+                               vector<vector<double>>& L,
+                               vector<vector<double>>& U,
+                               vector<int>& P) {
+        Macierz Lm, Um;
+        rozkladLU_zPivotingiem(Macierz(A), Lm, Um, P);
+        L = Lm.doWektorow();
+        U = Um.doWektorow();
+    }
+
+    // Rozklad w miejscu: po zakonczeniu W zawiera U na i nad przekatna oraz L (bez jedynek) pod przekatna.
+    // Panel o szerokosci rozmiarBloku jest rozkladany kolumna po kolumnie, potem blok U12 (rozwiazanie
+    // trojkatne z L11) i aktualizacja reszty macierzy A22 -= L21 * U12 wykonywana kafelkami,
+    // zeby kafelek U12 pozostawal w cache. Kolejnosc odejmowania dla kazdego elementu jest taka sama
+    // jak w rozkladLU_zPivotingiem, wiec wynik jest identyczny.
+    static void rozkladLU_blokowyWMiejscu(Macierz& W, vector<int>& zamiany, int rozmiarBloku) {
+        int n = W.wiersze();
+        zamiany.resize(n);
+
+        for (int kb = 0; kb < n; kb += rozmiarBloku) {
+            int koniecPanelu = min(kb + rozmiarBloku, n);
+
+            // rozklad panelu (kolumny kb..koniecPanelu-1)
+            for (int k = kb; k < koniecPanelu; k++) {
+                double max_val = 0.0;
+                int max_idx = k;
+                for (int i = k; i < n; i++) {
+                    double abs_val = fabs(W(i, k));
+                    if (abs_val > max_val) {
+                        max_val = abs_val;
+                        max_idx = i;
+                    }
+                }
+                if (max_val < 1e-10) {
+                    throw runtime_error("Macierz jest osobliwa");
+                }
+                zamiany[k] = max_idx;
+                if (max_idx != k) {
+                    W.zamienWiersze(k, max_idx);
+                }
+
+                const double* wiersz_k = W.wiersz(k);
+                for (int i = k + 1; i < n; i++) {
+                    double* wiersz_i = W.wiersz(i);
+                    double l_ik = wiersz_i[k] / wiersz_k[k];
+                    wiersz_i[k] = l_ik;
+                    axpy(koniecPanelu - k - 1, -l_ik, wiersz_k + k + 1, wiersz_i + k + 1);
+                }
+            }
+
+            if (koniecPanelu == n) {
+                break;
+            }
+
+            // U12 = L11^-1 * A12
+            for (int i = kb + 1; i < koniecPanelu; i++) {
+                double* wiersz_i = W.wiersz(i);
+                for (int k = kb; k < i; k++) {
+                    axpy(n - koniecPanelu, -wiersz_i[k], W.wiersz(k) + koniecPanelu, wiersz_i + koniecPanelu);
+                }
+            }
+
+            // A22 -= L21 * U12, kafelkami po kolumnach
+            for (int jb = koniecPanelu; jb < n; jb += rozmiarBloku) {
+                int koniecKafelka = min(jb + rozmiarBloku, n);
+                for (int i = koniecPanelu; i < n; i++) {
+                    double* wiersz_i = W.wiersz(i);
+                    for (int k = kb; k < koniecPanelu; k++) {
+                        axpy(koniecKafelka - jb, -wiersz_i[k], W.wiersz(k) + jb, wiersz_i + jb);
+                    }
+                }
+            }
+        }
+    }
+
+    // wektor permutacji P (wiersz i = wiersz P[i] macierzy A) z ciagu zamian wierszy
+    static vector<int> permutacjaZZamian(const vector<int>& zamiany) {
+        vector<int> P(zamiany.size());
+        for (size_t i = 0; i < P.size(); i++) {
+            P[i] = i;
+        }
+        for (size_t k = 0; k < zamiany.size(); k++) {
+            swap(P[k], P[zamiany[k]]);
+        }
+        return P;
+    }
+
+    // rozdzielenie spakowanego wyniku na L (z jedynkami na przekatnej) i U
+    static void rozdzielLU(const Macierz& W, Macierz& L, Macierz& U) {
+        int n = W.wiersze();
+        L = Macierz::jednostkowa(n);
+        U.zmienRozmiar(n, n);
+        for (int i = 0; i < n; i++) {
+            const double* wiersz_W = W.wiersz(i);
+            double* wiersz_L = L.wiersz(i);
+            double* wiersz_U = U.wiersz(i);
+            for (int j = 0; j < i; j++) {
+                wiersz_L[j] = wiersz_W[j];
+            }
+            for (int j = i; j < n; j++) {
+                wiersz_U[j] = wiersz_W[j];
+            }
+        }
+    }
+
+    void rozkladLU_blokowy(const Macierz& A,
+                          Macierz& L,
+                          Macierz& U,
+                          vector<int>& P,
+                          int rozmiarBloku) {
+        int n = A.wiersze();
+        if (A.kolumny() != n) {
+            throw invalid_argument("Macierz musi być kwadratowa");
+        }
+        if (rozmiarBloku < 1) {
+            throw invalid_argument("Rozmiar bloku musi być dodatni");
+        }
+
+        Macierz W = A;
+        vector<int> zamiany;
+        rozkladLU_blokowyWMiejscu(W, zamiany, rozmiarBloku);
+        P = permutacjaZZamian(zamiany);
+        rozdzielLU(W, L, U);
+    }
+
+    void rozkladLU_blokowy(const vector<vector<double>>& A,
+                          vector<vector<double>>& L,
+                          vector<vector<double>>& U,
+                          vector<int>& P,
+                          int rozmiarBloku) {
+        Macierz Lm, Um;
+        rozkladLU_blokowy(Macierz(A), Lm, Um, P, rozmiarBloku);
+        L = Lm.doWektorow();
+        U = Um.doWektorow();
+    }
+
+    void rozkladLU_wMiejscu(Macierz& A, vector<int>& zamiany, int rozmiarBloku) {
+        if (A.kolumny() != A.wiersze()) {
+            throw invalid_argument("Macierz musi być kwadratowa");
+        }
+        if (rozmiarBloku < 1) {
+            throw invalid_argument("Rozmiar bloku musi być dodatni");
+        }
+        rozkladLU_blokowyWMiejscu(A, zamiany, rozmiarBloku);
+    }
+
+    void rozwiazLU_wMiejscu(const Macierz& LU, const vector<int>& zamiany, vector<double>& b) {
+        int n = LU.wiersze();
+        if (b.size() != n || zamiany.size() != n) {
+            throw invalid_argument("Nieprawidłowe wymiary macierzy lub wektora");
+        }
+
+        for (int i = 0; i < n; i++) {
+            swap(b[i], b[zamiany[i]]);
+        }
+
+        // Ly = Pb, L z jedynkami na przekatnej, potem Ux = y
+        podstawianieWPrzod(LU, b.data(), true);
+        podstawianieWstecz(LU, b.data());
+    }
+
+    void rozwiazLU_wMiejscu(const Macierz& LU, const vector<int>& zamiany, Macierz& B) {
+        int n = LU.wiersze();
+        int m = B.kolumny();
+        if (B.wiersze() != n || zamiany.size() != n) {
+            throw invalid_argument("Nieprawidłowe wymiary macierzy prawych stron");
+        }
+
+        for (int i = 0; i < n; i++) {
+            if (zamiany[i] != i) {
+                B.zamienWiersze(i, zamiany[i]);
+            }
+        }
+
+        // operacje na calych wierszach B - kazda prawa strona jest przetwarzana w tej samej petli
+        for (int i = 0; i < n; i++) {
+            const double* wiersz_LU = LU.wiersz(i);
+            double* wiersz_B = B.wiersz(i);
+            for (int k = 0; k < i; k++) {
+                axpy(m, -wiersz_LU[k], B.wiersz(k), wiersz_B);
+            }
+        }
+        for (int i = n - 1; i >= 0; i--) {
+            const double* wiersz_LU = LU.wiersz(i);
+            double* wiersz_B = B.wiersz(i);
+            for (int k = i + 1; k < n; k++) {
+                axpy(m, -wiersz_LU[k], B.wiersz(k), wiersz_B);
+            }
+            double odwrotnosc = 1.0 / wiersz_LU[i];
+            for (int j = 0; j < m; j++) {
+                wiersz_B[j] *= odwrotnosc;
+            }
+        }
+    }
+
+    // Rozklad kafelkowy w miejscu. Zadania jednego kroku k (kafelki kb..ke-1):
+    //  - panel(k): rozklad kolumny kafelkow k z wyborem elementu glownego, zamiany tylko w tej kolumnie,
+    //  - kolumna(k, j): zamiany wierszy z kroku k w kolumnie kafelkow j i U_kj = L_kk^-1 * A_kj,
+    //  - gemm(k, i, j): A_ij -= L_ik * U_kj.
+    // Zamiany w kolumnach na lewo od panelu wykonujemy na koncu, gdy wszystkie zadania sie zakoncza.
+    static void rozkladLU_kafelkowyWMiejscu(Macierz& W, vector<int>& P, int rozmiarKafelka, PulaWatkow& pula) {
+        int n = W.wiersze();
+        int nb = rozmiarKafelka;
+        int liczbaKafli = (n + nb - 1) / nb;
+        vector<int> piwoty(n);
+
+        GrafZadan graf;
+        // ostatnie zadanie zapisujace kafelek (i, j), -1 jesli zaden
+        vector<vector<int>> ostatniZapis(liczbaKafli, vector<int>(liczbaKafli, -1));
+
+        for (int k = 0; k < liczbaKafli; k++) {
+            int kb = k * nb;
+            int ke = min(kb + nb, n);
+
+            int panel = graf.dodajZadanie([&W, &piwoty, n, kb, ke] {
+                for (int kk = kb; kk < ke; kk++) {
+                    double max_val = 0.0;
+                    int max_idx = kk;
+                    for (int i = kk; i < n; i++) {
+                        double abs_val = fabs(W(i, kk));
+                        if (abs_val > max_val) {
+                            max_val = abs_val;
+                            max_idx = i;
+                        }
+                    }
+                    if (max_val < 1e-10) {
+                        throw runtime_error("Macierz jest osobliwa");
+                    }
+                    piwoty[kk] = max_idx;
+                    if (max_idx != kk) {
+                        swap_ranges(W.wiersz(kk) + kb, W.wiersz(kk) + ke, W.wiersz(max_idx) + kb);
+                    }
+
+                    const double* wiersz_k = W.wiersz(kk);
+                    for (int i = kk + 1; i < n; i++) {
+                        double* wiersz_i = W.wiersz(i);
+                        double l_ik = wiersz_i[kk] / wiersz_k[kk];
+                        wiersz_i[kk] = l_ik;
+                        axpy(ke - kk - 1, -l_ik, wiersz_k + kk + 1, wiersz_i + kk + 1);
+                    }
+                }
+            });
+            for (int i = k; i < liczbaKafli; i++) {
+                if (ostatniZapis[i][k] >= 0) {
+                    graf.dodajZaleznosc(ostatniZapis[i][k], panel);
+                }
+            }
+
+            for (int j = k + 1; j < liczbaKafli; j++) {
+                int jb = j * nb;
+                int je = min(jb + nb, n);
+
+                int kolumna = graf.dodajZadanie([&W, &piwoty, kb, ke, jb, je] {
+                    for (int r = kb; r < ke; r++) {
+                        if (piwoty[r] != r) {
+                            swap_ranges(W.wiersz(r) + jb, W.wiersz(r) + je, W.wiersz(piwoty[r]) + jb);
+                        }
+                    }
+                    for (int i = kb + 1; i < ke; i++) {
+                        double* wiersz_i = W.wiersz(i);
+                        for (int kk = kb; kk < i; kk++) {
+                            axpy(je - jb, -wiersz_i[kk], W.wiersz(kk) + jb, wiersz_i + jb);
+                        }
+                    }
+                });
+                graf.dodajZaleznosc(panel, kolumna);
+                for (int i = k; i < liczbaKafli; i++) {
+                    if (ostatniZapis[i][j] >= 0) {
+                        graf.dodajZaleznosc(ostatniZapis[i][j], kolumna);
+                    }
+                }
+
+                for (int i = k + 1; i < liczbaKafli; i++) {
+                    int ib = i * nb;
+                    int ie = min(ib + nb, n);
+                    int gemm = graf.dodajZadanie([&W, kb, ke, ib, ie, jb, je] {
+                        for (int r = ib; r < ie; r++) {
+                            double* wiersz_r = W.wiersz(r);
+                            for (int kk = kb; kk < ke; kk++) {
+                                axpy(je - jb, -wiersz_r[kk], W.wiersz(kk) + jb, wiersz_r + jb);
+                            }
+                        }
+                    });
+                    graf.dodajZaleznosc(kolumna, gemm);
+                    ostatniZapis[i][j] = gemm;
+                }
+            }
+        }
+
+        graf.wykonaj(pula);
+
+        // zamiany wierszy w czesci L na lewo od panelu, w ktorym zostaly wybrane, oraz wektor permutacji
+        P.resize(n);
+        for (int i = 0; i < n; i++) {
+            P[i] = i;
+        }
+        for (int r = 0; r < n; r++) {
+            if (piwoty[r] != r) {
+                int kb = r / nb * nb;
+                swap_ranges(W.wiersz(r), W.wiersz(r) + kb, W.wiersz(piwoty[r]));
+                swap(P[r], P[piwoty[r]]);
+            }
+        }
+    }
+
+    void rozkladLU_rownolegly(const Macierz& A,
+                             Macierz& L,
+                             Macierz& U,
+                             vector<int>& P,
+                             PulaWatkow& pula,
+                             int rozmiarKafelka) {
+        int n = A.wiersze();
+        if (A.kolumny() != n) {
+            throw invalid_argument("Macierz musi być kwadratowa");
+        }
+        if (rozmiarKafelka < 1) {
+            throw invalid_argument("Rozmiar kafelka musi być dodatni");
+        }
+
+        Macierz W = A;
+        rozkladLU_kafelkowyWMiejscu(W, P, rozmiarKafelka, pula);
+        rozdzielLU(W, L, U);
+    }
+
+    void rozkladLU_rownolegly(const Macierz& A,
+                             Macierz& L,
+                             Macierz& U,
+                             vector<int>& P,
+                             int liczbaWatkow,
+                             int rozmiarKafelka) {
+        PulaWatkow pula(liczbaWatkow);
+        rozkladLU_rownolegly(A, L, U, P, pula, rozmiarKafelka);
+    }
+
+    vector<double> permutujWektor(const vector<double>& b, const vector<int>& P) {
+        int n = b.size();
+        vector<double> pb(n);
+
+        for (int i = 0; i < n; i++) {
+            pb[i] = b[P[i]];
+        }
+
+        return pb;
+    }
+
+    vector<double> rozwiazLy_b(const Macierz& L, const vector<double>& b) {
+        int n = L.wiersze();
+        vector<double> y(n);
+
+        SLEDZ(komunikat("Ly = b"));
+        for (int i = 0; i < n; i++) {
+            const double* wiersz_i = L.wiersz(i);
+            double suma = iloczynSkalarny(i, wiersz_i, y.data());
+            y[i] = (b[i] - suma) / wiersz_i[i];
+        }
+
+        return y;
+    }
+
+    vector<double> rozwiazLy_b(const vector<vector<double>>& L, const vector<double>& b) {
+        return rozwiazLy_b(Macierz(L), b);
+    }
+
+    vector<double> rozwiazUx_y(const Macierz& U, const vector<double>& y) {
+        int n = U.wiersze();
+        vector<double> x(n);
+
+        SLEDZ(komunikat("Ux = y"));
+        for (int i = n - 1; i >= 0; i--) {
+            const double* wiersz_i = U.wiersz(i);
+            double suma = iloczynSkalarny(n - i - 1, wiersz_i + i + 1, x.data() + i + 1);
+            if (fabs(wiersz_i[i]) < 1e-10) {
+                SLEDZ(ostrzezenie("Element przekątnej U zbyt bliski zeru (wiersz " + to_string(i + 1) + ")"));
+                throw runtime_error("Macierz jest osobliwa");
+            }
+            x[i] = (y[i] - suma) / wiersz_i[i];
+
+            SLEDZ(komunikat(to_string(n-i) + ": " + tekst(x[i])));
+        }
+
+        return x;
+    }
+
+    vector<double> rozwiazUx_y(const vector<vector<double>>& U, const vector<double>& y) {
+        return rozwiazUx_y(Macierz(U), y);
+    }
+
+    double sprawdzPoprawnosc(const Macierz& A,
+                            const vector<double>& x,
+                            const vector<double>& b) {
+        int n = A.wiersze();
+        double maxBled = 0.0;
+
+        SLEDZ(komunikat("Sprawdzanie poprawności rozwiązania "));
+        SLEDZ(komunikat("A * x = b?"));
+
+        for (int i = 0; i < n; i++) {
+            double suma = iloczynSkalarny(n, A.wiersz(i), x.data());
+            double blad = fabs(suma - b[i]);
+            SLEDZ(komunikat("Wiersz " + to_string(i+1) + ": " + tekst(suma) + " ?= " + tekst(b[i])
+                            + " (błąd: " + tekst(blad) + ")"));
+
+            if (blad > maxBled) {
+                maxBled = blad;
+            }
+        }
+
+        SLEDZ(komunikat("Maksymalny błąd: " + tekst(maxBled)));
+
+        return maxBled;
+    }
+
+    double sprawdzPoprawnosc(const vector<vector<double>>& A,
+                            const vector<double>& x,
+                            const vector<double>& b) {
+        return sprawdzPoprawnosc(Macierz(A), x, b);
+    }
+
+    pair<vector<double>, vector<double>> rozwiazUkladLU(const Macierz& A,
+                                                        const vector<double>& b) {
+        if (PamiecRozkladow* pamiec = pamiecRozkladow()) {
+            if (A.wiersze() != A.kolumny() || b.size() != A.wiersze()) {
+                throw invalid_argument("Nieprawidłowe wymiary macierzy lub wektora");
+            }
+            shared_ptr<const RozkladLU> lu = pamiec->rozklad(A);
+            vector<double> y = permutujWektor(b, lu->permutacja());
+            SLEDZ(wektor(y, "Permutowany wektor b"));
+            podstawianieWPrzod(lu->macierzLU(), y.data(), true);
+            vector<double> x = y;
+            podstawianieWstecz(lu->macierzLU(), x.data());
+            return make_pair(y, x);
+        }
+
+        Macierz L, U;
+        vector<int> P;
+
+        rozkladLU_zPivotingiem(A, L, U, P);
+
+        vector<double> pb = permutujWektor(b, P);
+        SLEDZ(wektor(pb, "Permutowany wektor b"));
+
+        vector<double> y = rozwiazLy_b(L, pb);
+
+        vector<double> x = rozwiazUx_y(U, y);
+
+        return make_pair(y, x);
+    }
+
+    pair<vector<double>, vector<double>> rozwiazUkladLU(const vector<vector<double>>& A,
+                                                        const vector<double>& b) {
+        return rozwiazUkladLU(Macierz(A), b);
+    }
+
+    // rozklad LU w float (wiersze w ciaglym buforze o kroku krok), P jako wektor permutacji;
+    // false, gdy element glowny jest zerowy lub pojawia sie wartosc nieskonczona
+    static bool rozkladLU_float(vector<float, AlokatorWyrownany<float>>& F, int n, int krok, vector<int>& P) {
+        P.resize(n);
+        for (int i = 0; i < n; i++) {
+            P[i] = i;
+        }
+        for (int k = 0; k < n; k++) {
+            int p = k;
+            for (int i = k + 1; i < n; i++) {
+                if (fabs(F[(size_t)i * krok + k]) > fabs(F[(size_t)p * krok + k])) {
+                    p = i;
+                }
+            }
+            float a_kk = F[(size_t)p * krok + k];
+            if (a_kk == 0.0f || !isfinite(a_kk)) {
+                return false;
+            }
+            if (p != k) {
+                swap_ranges(F.begin() + (size_t)k * krok, F.begin() + (size_t)k * krok + n, F.begin() + (size_t)p * krok);
+                swap(P[k], P[p]);
+            }
+            const float* wiersz_k = F.data() + (size_t)k * krok;
+            for (int i = k + 1; i < n; i++) {
+                float* wiersz_i = F.data() + (size_t)i * krok;
+                float l = wiersz_i[k] / a_kk;
+                wiersz_i[k] = l;
+                for (int j = k + 1; j < n; j++) {
+                    wiersz_i[j] -= l * wiersz_k[j];
+                }
+            }
+        }
+        return true;
+    }
+
+    // rozwiazuje (LU)_f d = r w float; r w double jest permutowane i zaokraglane do float
+    static void rozwiazLU_float(const vector<float, AlokatorWyrownany<float>>& F, int n, int krok,
+                                const vector<int>& P, const vector<double>& r, vector<double>& d) {
+        vector<float> y(n);
+        for (int i = 0; i < n; i++) {
+            y[i] = static_cast<float>(r[P[i]]);
+        }
+        for (int i = 0; i < n; i++) {
+            const float* wiersz_i = F.data() + (size_t)i * krok;
+            float suma = y[i];
+            for (int j = 0; j < i; j++) {
+                suma -= wiersz_i[j] * y[j];
+            }
+            y[i] = suma;
+        }
+        for (int i = n - 1; i >= 0; i--) {
+            const float* wiersz_i = F.data() + (size_t)i * krok;
+            float suma = y[i];
+            for (int j = i + 1; j < n; j++) {
+                suma -= wiersz_i[j] * y[j];
+            }
+            y[i] = suma / wiersz_i[i];
+        }
+        d.assign(y.begin(), y.end());
+    }
+
+    WynikMieszanejPrecyzji rozwiazUkladLU_mieszanaPrecyzja(const Macierz& A,
+                                                            const vector<double>& b,
+                                                            int maxKrokow) {
+        int n = A.wiersze();
+        if (n == 0 || A.kolumny() != n || b.size() != n) {
+            throw invalid_argument("Nieprawidłowe wymiary");
+        }
+
+        WynikMieszanejPrecyzji wynik;
+        double normaA = 0.0;
+        for (int i = 0; i < n; i++) {
+            double suma = 0.0;
+            for (int j = 0; j < n; j++) {
+                suma += fabs(A(i, j));
+            }
+            normaA = max(normaA, suma);
+        }
+        auto normaMax = [](const vector<double>& v) {
+            double m = 0.0;
+            for (double x : v) m = max(m, fabs(x));
+            return m;
+        };
+
+        // kopia A w float; elementy poza zakresem float wymuszaja od razu rozklad w double
+        const int krok = (n + 15) / 16 * 16;
+        vector<float, AlokatorWyrownany<float>> F((size_t)n * krok, 0.0f);
+        bool wZakresie = true;
+        for (int i = 0; i < n && wZakresie; i++) {
+            for (int j = 0; j < n; j++) {
+                if (fabs(A(i, j)) > numeric_limits<float>::max()) {
+                    wZakresie = false;
+                    break;
+                }
+                F[(size_t)i * krok + j] = static_cast<float>(A(i, j));
+            }
+        }
+        vector<int> P;
+        bool zbiezny = false;
+
+        if (wZakresie && rozkladLU_float(F, n, krok, P)) {
+            // kryterium jak w dsgesv: ||r|| <= ||x|| ||A|| eps sqrt(n)
+            const double prog = normaA * numeric_limits<double>::epsilon() * sqrt((double)n);
+            vector<double> r(n), d(n);
+            rozwiazLU_float(F, n, krok, P, b, wynik.x);
+            double poprzednieResiduum = INFINITY;
+
+            while (true) {
+                for (int i = 0; i < n; i++) {
+                    r[i] = b[i] - iloczynSkalarny(n, A.wiersz(i), wynik.x.data());
+                }
+                double normaR = normaMax(r);
+                double normaX = normaMax(wynik.x);
+                SLEDZ(komunikat("Mieszana precyzja: krok " + to_string(wynik.krokiPoprawek) +
+                                ", ||r|| = " + tekst(normaR)));
+                if (normaR <= normaX * prog) {
+                    zbiezny = true;
+                    break;
+                }
+                // zastoj: residuum nie maleje co najmniej dwukrotnie albo wyczerpany limit krokow
+                if (!isfinite(normaR) || normaR > 0.5 * poprzednieResiduum || wynik.krokiPoprawek >= maxKrokow) {
+                    break;
+                }
+                poprzednieResiduum = normaR;
+                rozwiazLU_float(F, n, krok, P, r, d);
+                axpy(n, 1.0, d.data(), wynik.x.data());
+                wynik.krokiPoprawek++;
+            }
+        }
+
+        if (!zbiezny) {
+            SLEDZ(ostrzezenie("Mieszana precyzja: poprawianie nie osiągnęło dokładności double, rozkład LU w double"));
+            wynik.uzytoPodwojnejPrecyzji = true;
+            wynik.x = RozkladLU(A).solve(b);
+        }
+
+        vector<double> r(n);
+        for (int i = 0; i < n; i++) {
+            r[i] = b[i] - iloczynSkalarny(n, A.wiersz(i), wynik.x.data());
+        }
+        double mianownik = normaA * normaMax(wynik.x);
+        wynik.residuumWzgledne = mianownik > 0.0 ? normaMax(r) / mianownik : normaMax(r);
+        return wynik;
+    }
+
+    WynikMieszanejPrecyzji rozwiazUkladLU_mieszanaPrecyzja(const vector<vector<double>>& A,
+                                                            const vector<double>& b,
+                                                            int maxKrokow) {
+        if (A.empty()) {
+            throw invalid_argument("Nieprawidłowe wymiary");
+        }
+        return rozwiazUkladLU_mieszanaPrecyzja(Macierz(A), b, maxKrokow);
+    }
+
+    RozkladLU::RozkladLU(const Macierz& A, int rozmiarBloku) : LU_(A) {
+        rozkladLU_wMiejscu(LU_, zamiany_, rozmiarBloku);
+        P_ = permutacjaZZamian(zamiany_);
+    }
+
+    RozkladLU::RozkladLU(const vector<vector<double>>& A, int rozmiarBloku)
+        : RozkladLU(Macierz(A), rozmiarBloku) {}
+
+    vector<double> RozkladLU::solve(const vector<double>& b) const {
+        vector<double> x = b;
+        solve_in_place(x);
+        return x;
+    }
+
+    void RozkladLU::solve_in_place(vector<double>& b) const {
+        rozwiazLU_wMiejscu(LU_, zamiany_, b);
+    }
+
+    Macierz RozkladLU::solve_many(const Macierz& B) const {
+        Macierz X = B;
+        rozwiazLU_wMiejscu(LU_, zamiany_, X);
+        return X;
+    }
+
+    vector<vector<double>> RozkladLU::solve_many(const vector<vector<double>>& B) const {
+        vector<vector<double>> X = B;
+        for (auto& x : X) {
+            solve_in_place(x);
+        }
+        return X;
+    }
+
+    vector<double> RozkladLU::solve_transposed(const vector<double>& b) const {
+        vector<double> x = b;
+        solve_transposed_in_place(x);
+        return x;
+    }
+
+    void RozkladLU::solve_transposed_in_place(vector<double>& b) const {
+        int n = rozmiar();
+        if (b.size() != n) {
+            throw invalid_argument("Nieprawidłowe wymiary macierzy lub wektora");
+        }
+
+        // U^T z = b: kolumna k macierzy U^T to wiersz k macierzy U, wiec petle ida po wierszach LU_
+        for (int k = 0; k < n; k++) {
+            const double* wiersz = LU_.wiersz(k);
+            double z_k = b[k] / wiersz[k];
+            b[k] = z_k;
+            for (int j = k + 1; j < n; j++) {
+                b[j] -= wiersz[j] * z_k;
+            }
+        }
+        // L^T w = z (jedynki na przekatnej)
+        for (int k = n - 1; k > 0; k--) {
+            const double* wiersz = LU_.wiersz(k);
+            double w_k = b[k];
+            for (int j = 0; j < k; j++) {
+                b[j] -= wiersz[j] * w_k;
+            }
+        }
+        // x = P^T w: zamiany w odwrotnej kolejnosci
+        for (int i = n - 1; i >= 0; i--) {
+            swap(b[i], b[zamiany_[i]]);
+        }
+    }
+
+    double RozkladLU::oszacujNormeOdwrotnosci() const {
+        int n = rozmiar();
+        if (n == 0) {
+            return 0.0;
+        }
+        auto norma1 = [](const vector<double>& v) {
+            double suma = 0.0;
+            for (double x : v) suma += fabs(x);
+            return suma;
+        };
+        auto znak = [](double x) { return x >= 0.0 ? 1.0 : -1.0; };
+        auto najwiekszy = [](const vector<double>& v) {
+            int j = 0;
+            for (int i = 1; i < (int)v.size(); i++) {
+                if (fabs(v[i]) > fabs(v[j])) j = i;
+            }
+            return j;
+        };
+
+        // x = (1/n, ..., 1/n), potem kolejne wektory jednostkowe e_j wskazywane przez gradient A^{-T} sign(A^{-1} x)
+        vector<double> x(n, 1.0 / n);
+        solve_in_place(x);
+        double oszacowanie = norma1(x);
+        vector<double> znaki(n);
+        for (int i = 0; i < n; i++) znaki[i] = znak(x[i]);
+        vector<double> z = solve_transposed(znaki);
+        int j = najwiekszy(z);
+
+        for (int iteracja = 0; iteracja < 5 && n > 1; iteracja++) {
+            x.assign(n, 0.0);
+            x[j] = 1.0;
+            solve_in_place(x);
+            double nowe = norma1(x);
+            bool teSameZnaki = true;
+            for (int i = 0; i < n && teSameZnaki; i++) {
+                teSameZnaki = znak(x[i]) == znaki[i];
+            }
+            if (teSameZnaki || nowe <= oszacowanie) {
+                oszacowanie = max(oszacowanie, nowe);
+                break;
+            }
+            oszacowanie = nowe;
+            for (int i = 0; i < n; i++) znaki[i] = znak(x[i]);
+            z = solve_transposed(znaki);
+            int poprzedni = j;
+            j = najwiekszy(z);
+            if (fabs(z[poprzedni]) == fabs(z[j])) {
+                break;
+            }
+        }
+
+        // dodatkowy wektor o naprzemiennych znakach - chroni przed przypadkami, w których iteracja zawodzi
+        for (int i = 0; i < n; i++) {
+            x[i] = (i % 2 == 0 ? 1.0 : -1.0) * (1.0 + (n > 1 ? double(i) / (n - 1) : 0.0));
+        }
+        solve_in_place(x);
+        return max(oszacowanie, 2.0 * norma1(x) / (3.0 * n));
+    }
+
+    static double normaJeden(const Macierz& A) {
+        vector<double> sumy(A.kolumny(), 0.0);
+        for (int i = 0; i < A.wiersze(); i++) {
+            const double* wiersz = A.wiersz(i);
+            for (int j = 0; j < A.kolumny(); j++) {
+                sumy[j] += fabs(wiersz[j]);
+            }
+        }
+        return sumy.empty() ? 0.0 : *max_element(sumy.begin(), sumy.end());
+    }
+
+    double oszacujUwarunkowanie(const Macierz& A, const RozkladLU& lu) {
+        if (A.wiersze() != lu.rozmiar() || A.kolumny() != lu.rozmiar()) {
+            throw invalid_argument("Rozkład nie odpowiada macierzy");
+        }
+        return normaJeden(A) * lu.oszacujNormeOdwrotnosci();
+    }
+
+    double wspolczynnikWzrostu(const Macierz& A, const RozkladLU& lu) {
+        int n = lu.rozmiar();
+        if (A.wiersze() != n || A.kolumny() != n) {
+            throw invalid_argument("Rozkład nie odpowiada macierzy");
+        }
+        double maxA = 0.0, maxU = 0.0;
+        for (int i = 0; i < n; i++) {
+            const double* a = A.wiersz(i);
+            const double* u = lu.macierzLU().wiersz(i);
+            for (int j = 0; j < n; j++) {
+                maxA = max(maxA, fabs(a[j]));
+            }
+            for (int j = i; j < n; j++) {
+                maxU = max(maxU, fabs(u[j]));
             }
-            cout << endl;
+        }
+        return maxA > 0.0 ? maxU / maxA : 0.0;
+    }
+
+    RaportRozwiazaniaLU rozwiazUkladLU_zRaportem(const Macierz& A, const vector<double>& b) {
+        if (A.wiersze() != A.kolumny() || b.size() != A.wiersze()) {
+            throw invalid_argument("Nieprawidłowe wymiary macierzy lub wektora");
+        }
+        PamiecRozkladow* pamiec = pamiecRozkladow();
+        shared_ptr<const RozkladLU> lu = pamiec ? pamiec->rozklad(A) : make_shared<const RozkladLU>(A);
+
+        RaportRozwiazaniaLU raport;
+        raport.y = permutujWektor(b, lu->permutacja());
+        podstawianieWPrzod(lu->macierzLU(), raport.y.data(), true);
+        raport.x = raport.y;
+        podstawianieWstecz(lu->macierzLU(), raport.x.data());
+        raport.uwarunkowanie = oszacujUwarunkowanie(A, *lu);
+        raport.wspolczynnikWzrostu = wspolczynnikWzrostu(A, *lu);
+        return raport;
+    }
+
+    RaportRozwiazaniaLU rozwiazUkladLU_zRaportem(const vector<vector<double>>& A, const vector<double>& b) {
+        if (A.empty()) {
+            throw invalid_argument("Nieprawidłowe wymiary");
+        }
+        return rozwiazUkladLU_zRaportem(Macierz(A), b);
+    }
+
+    void utworzMacierzDopelniona(const Macierz& A, const vector<double>& B, Macierz& macierzDopelniona) {
+        int N = A.wiersze();
+        macierzDopelniona.zmienRozmiar(N, N + 1);
+        //macierz dopelniona ma o 1 wiecej kolumn, ostatnia kolumna to wyrazy wolne
+
+        for (int i = 0; i < N; i++) {
+            const double* wiersz_A = A.wiersz(i);
+            double* wiersz_D = macierzDopelniona.wiersz(i);
+            for (int j = 0; j < N; j++) {
+                wiersz_D[j] = wiersz_A[j];
+            }
+            wiersz_D[N] = B[i];             //dodawanie wyrazow wolnych do ostatniej koluny
+        }
+    }
+    void utworzMacierzDopelniona(const vector<vector<double>>& A, const vector<double>& B, vector<vector<double>>& macierzDopelniona) {
+        Macierz D;
+        utworzMacierzDopelniona(Macierz(A), B, D);
+        macierzDopelniona = D.doWektorow();
+    }
+    void wyswietlMacierz(const Macierz& macierz, const string& nazwa) {
+        cout << nazwa << ":" << endl;
+        for (int i = 0; i < macierz.wiersze(); i++) {
+            const double* wiersz = macierz.wiersz(i);
+            for (int j = 0; j < macierz.kolumny(); j++) {
+                cout << setw(10) << fixed << setprecision(4) << wiersz[j] << " ";
+            }
+            cout << endl;
         }
         cout << endl;
     }
-}
-vector<double> rozwiazUklad(const vector<vector<double>>& macierzSchodkowa) {
-    int N = macierzSchodkowa.size();
-    vector<double> X(N, 0);
+    void wyswietlMacierz(const vector<vector<double>>& macierz, const string& nazwa) {
+        cout << nazwa << ":" << endl;
+        for (const auto& wiersz : macierz) {
+            for (double element : wiersz) {
+                cout << setw(10) << fixed << setprecision(4) << element << " ";
+            }
+            cout << endl;
+        }
+        cout << endl;
+    }
+    void wyswietlWektor(const vector<double>& wektor, const string& nazwa) {
+        cout << nazwa << ":" << endl;
+        for (double element : wektor) {
+            cout << setw(10) << fixed << setprecision(4) << element << " ";
+        }
+        cout << endl << endl;
+    }
+    void sprawdzWynik(const Macierz& A, const vector<double>& B, const vector<double>& X) {
+    int N = A.wiersze();
+    cout << "sprawdzanie wynikow: :" << endl;
 
-    for (int i = N - 1; i >= 0; i--) {
+    for (int i = 0; i < N; i++) {
+        const double* wiersz_i = A.wiersz(i);
         double suma = 0;
+        for (int j = 0; j < N; j++) {
+            suma += wiersz_i[j] * X[j];
+        }
+        cout << "Równanie " << i+1 << ": ";
+        cout << suma << " w przyblizeniu rowne: " << B[i] << endl;
+    }
+    cout << endl;
+}
+    void sprawdzWynik(const vector<vector<double>>& A, const vector<double>& B, const vector<double>& X) {
+        sprawdzWynik(Macierz(A), B, X);
+    }
+void sprowadzanieDoPostaciSchodkowej(Macierz& macierzDopelniona) {
+    int N = macierzDopelniona.wiersze();
+
+    for (int i = 0; i < N; i++) {
+        if (fabs(macierzDopelniona(i, i)) < 1e-10) {                // element na przekatnej jest rowny 0 (w tym przypadku skorzystalem z precyzji)
+            int indeksMax = i;
+            double wartoscMax = fabs(macierzDopelniona(i, i));
+
+            for (int j = i + 1; j < N; j++) {                           // szukanie elementu o najwiekszym module w kolumne gdzie 0 jest na przekatnej macierzy
+                if (fabs(macierzDopelniona(j, i)) > wartoscMax) {
+                    indeksMax = j;
+                    wartoscMax = fabs(macierzDopelniona(j, i));
+                }
+            }
+
+            if (indeksMax != i) {
+                SLEDZ(komunikat("Pivoting: zamiana wierszy " + to_string(i+1) + " i " + to_string(indeksMax+1)));
+                macierzDopelniona.zamienWiersze(i, indeksMax);
+            }
+        }
+
+        if (fabs(macierzDopelniona(i, i)) < 1e-10) { //jesli na przekatnej sa 0 to brak rozwiazan
+            SLEDZ(komunikat("brak rozwiazan!"));
+            continue;
+        }
+
+        const double* wiersz_i = macierzDopelniona.wiersz(i);
         for (int j = i + 1; j < N; j++) {
-            suma += macierzSchodkowa[i][j] * X[j];
+            double* wiersz_j = macierzDopelniona.wiersz(j);
+            double mnoznnik = wiersz_j[i] / wiersz_i[i];                //zerowanie elementow ponizej przekatnej
+            axpy(N + 1 - i, -mnoznnik, wiersz_i + i, wiersz_j + i);
         }
 
-        if (fabs(macierzSchodkowa[i][i]) < 1e-10) {
-            cout << "dzielenie przez 0 przy x" << i+1 << endl;
+        SLEDZ(macierz(macierzDopelniona, "Po eliminacji dla wiersza " + to_string(i+1)));       //wyswietlanie macierzy co iteracje po wyzerowaniu kolumny ponizej przekatnej
+    }
+}
+void sprowadzanieDoPostaciSchodkowej(vector<vector<double>>& macierzDopelniona) {
+    Macierz D(macierzDopelniona);
+    sprowadzanieDoPostaciSchodkowej(D);
+    macierzDopelniona = D.doWektorow();
+}
+vector<double> rozwiazUklad(const Macierz& macierzSchodkowa) {
+    int N = macierzSchodkowa.wiersze();
+    vector<double> X(N, 0);
+
+    for (int i = N - 1; i >= 0; i--) {
+        const double* wiersz_i = macierzSchodkowa.wiersz(i);
+        double suma = iloczynSkalarny(N - i - 1, wiersz_i + i + 1, X.data() + i + 1);
+
+        if (fabs(wiersz_i[i]) < 1e-10) {
+            SLEDZ(ostrzezenie("dzielenie przez 0 przy x" + to_string(i+1)));
             X[i] = 0; // wartosci 0 dla wartosci nieokreslonych
         } else {
-            X[i] = (macierzSchodkowa[i][N] - suma) / macierzSchodkowa[i][i];
+            X[i] = (wiersz_i[N] - suma) / wiersz_i[i];
         }
     }
 
     return X;
 }
+vector<double> rozwiazUklad(const vector<vector<double>>& macierzSchodkowa) {
+    return rozwiazUklad(Macierz(macierzSchodkowa));
+}
+
+    // poczatek wiersza i w spakowanym dolnym trojkacie (wiersz i ma i + 1 elementow)
+    static inline size_t poczatekWiersza(int i) {
+        return static_cast<size_t>(i) * (i + 1) / 2;
+    }
+
+    RozkladCholeskyego::RozkladCholeskyego(const Macierz& A, int rozmiarBloku) {
+        rozloz(A, rozmiarBloku);
+    }
+
+    RozkladCholeskyego::RozkladCholeskyego(const vector<vector<double>>& A, int rozmiarBloku) {
+        if (A.empty()) {
+            throw invalid_argument("Macierz jest pusta");
+        }
+        rozloz(Macierz(A), rozmiarBloku);
+    }
+
+    void RozkladCholeskyego::rozloz(const Macierz& A, int rozmiarBloku) {
+        n_ = A.wiersze();
+        if (n_ == 0 || A.kolumny() != n_) {
+            throw invalid_argument("Macierz musi być kwadratowa");
+        }
+        if (rozmiarBloku < 1) {
+            throw invalid_argument("Rozmiar bloku musi być dodatni");
+        }
+        L_.resize(poczatekWiersza(n_));
+        for (int i = 0; i < n_; i++) {
+            copy(A.wiersz(i), A.wiersz(i) + i + 1, L_.data() + poczatekWiersza(i));
+        }
+        auto l = [this](int i, int j) -> double& { return L_[poczatekWiersza(i) + j]; };
+
+        // prawostronny wariant blokowy: blok diagonalny, panel pod nim, aktualizacja reszty
+        for (int kb = 0; kb < n_; kb += rozmiarBloku) {
+            int ke = min(n_, kb + rozmiarBloku);
+
+            for (int j = kb; j < ke; j++) {
+                double d = l(j, j) - iloczynSkalarny(j - kb, &l(j, kb), &l(j, kb));
+                if (!(d > 0.0)) {
+                    status_ = StatusRozkladu::NieDodatnioOkreslona;
+                    kolumnaBledu_ = j;
+                    SLEDZ(ostrzezenie("Rozkład Cholesky'ego: macierz nie jest dodatnio określona (kolumna " +
+                                      to_string(j + 1) + ")"));
+                    return;
+                }
+                l(j, j) = sqrt(d);
+                for (int i = j + 1; i < n_; i++) {
+                    l(i, j) = (l(i, j) - iloczynSkalarny(j - kb, &l(i, kb), &l(j, kb))) / l(j, j);
+                }
+            }
+
+            // A22 -= L21 L21^T (tylko dolny trojkat), kafelkami po wierszach j
+            int szer = ke - kb;
+            for (int jb = ke; jb < n_; jb += rozmiarBloku) {
+                int je = min(n_, jb + rozmiarBloku);
+                for (int i = jb; i < n_; i++) {
+                    const double* l_i = &l(i, kb);
+                    for (int j = jb; j < min(je, i + 1); j++) {
+                        l(i, j) -= iloczynSkalarny(szer, l_i, &l(j, kb));
+                    }
+                }
+            }
+        }
+    }
+
+    void RozkladCholeskyego::sprawdzStatus() const {
+        if (status_ != StatusRozkladu::Poprawny) {
+            throw runtime_error("Rozkład Cholesky'ego nie powiódł się: macierz nie jest dodatnio określona (kolumna " +
+                                to_string(kolumnaBledu_ + 1) + ")");
+        }
+    }
+
+    vector<double> RozkladCholeskyego::solve(const vector<double>& b) const {
+        vector<double> x = b;
+        solve_in_place(x);
+        return x;
+    }
+
+    void RozkladCholeskyego::solve_in_place(vector<double>& b) const {
+        sprawdzStatus();
+        if (b.size() != n_) {
+            throw invalid_argument("Nieprawidłowy rozmiar wektora prawej strony");
+        }
+        // L y = b: wiersze L sa ciagle
+        for (int i = 0; i < n_; i++) {
+            const double* l_i = L_.data() + poczatekWiersza(i);
+            b[i] = (b[i] - iloczynSkalarny(i, l_i, b.data())) / l_i[i];
+        }
+        // L^T x = y: wiersz i L to kolumna i L^T
+        for (int i = n_ - 1; i >= 0; i--) {
+            const double* l_i = L_.data() + poczatekWiersza(i);
+            b[i] /= l_i[i];
+            axpy(i, -b[i], l_i, b.data());
+        }
+    }
+
+    Macierz RozkladCholeskyego::solve_many(const Macierz& B) const {
+        sprawdzStatus();
+        if (B.wiersze() != n_) {
+            throw invalid_argument("Nieprawidłowe wymiary macierzy prawych stron");
+        }
+        int m = B.kolumny();
+        Macierz X = B;
+        for (int i = 0; i < n_; i++) {
+            const double* l_i = L_.data() + poczatekWiersza(i);
+            double* x_i = X.wiersz(i);
+            for (int k = 0; k < i; k++) {
+                axpy(m, -l_i[k], X.wiersz(k), x_i);
+            }
+            double odwrotnosc = 1.0 / l_i[i];
+            for (int j = 0; j < m; j++) {
+                x_i[j] *= odwrotnosc;
+            }
+        }
+        for (int i = n_ - 1; i >= 0; i--) {
+            const double* l_i = L_.data() + poczatekWiersza(i);
+            double* x_i = X.wiersz(i);
+            double odwrotnosc = 1.0 / l_i[i];
+            for (int j = 0; j < m; j++) {
+                x_i[j] *= odwrotnosc;
+            }
+            for (int k = 0; k < i; k++) {
+                axpy(m, -l_i[k], x_i, X.wiersz(k));
+            }
+        }
+        return X;
+    }
+
+    vector<vector<double>> RozkladCholeskyego::solve_many(const vector<vector<double>>& B) const {
+        vector<vector<double>> X = B;
+        for (auto& x : X) {
+            solve_in_place(x);
+        }
+        return X;
+    }
+
+    Macierz RozkladCholeskyego::czynnikL() const {
+        Macierz L(n_, n_);
+        for (int i = 0; i < n_; i++) {
+            copy(L_.data() + poczatekWiersza(i), L_.data() + poczatekWiersza(i) + i + 1, L.wiersz(i));
+        }
+        return L;
+    }
+
+    RozkladLDLT::RozkladLDLT(const Macierz& A) {
+        rozloz(A);
+    }
+
+    RozkladLDLT::RozkladLDLT(const vector<vector<double>>& A) {
+        if (A.empty()) {
+            throw invalid_argument("Macierz jest pusta");
+        }
+        rozloz(Macierz(A));
+    }
+
+    void RozkladLDLT::rozloz(const Macierz& A) {
+        n_ = A.wiersze();
+        if (n_ == 0 || A.kolumny() != n_) {
+            throw invalid_argument("Macierz musi być kwadratowa");
+        }
+        L_.resize(poczatekWiersza(n_));
+        for (int i = 0; i < n_; i++) {
+            copy(A.wiersz(i), A.wiersz(i) + i + 1, L_.data() + poczatekWiersza(i));
+        }
+        poddiagonalaD_.assign(n_, 0.0);
+        P_.resize(n_);
+        for (int i = 0; i < n_; i++) {
+            P_[i] = i;
+        }
+        auto a = [this](int i, int j) -> double& {
+            return i >= j ? L_[poczatekWiersza(i) + j] : L_[poczatekWiersza(j) + i];
+        };
+
+        // symetryczna zamiana wierszy i kolumn p < q (takze w juz policzonych kolumnach L)
+        auto zamien = [&](int p, int q) {
+            for (int j = 0; j < p; j++) swap(a(p, j), a(q, j));
+            for (int j = p + 1; j < q; j++) swap(a(j, p), a(q, j));
+            swap(a(p, p), a(q, q));
+            for (int i = q + 1; i < n_; i++) swap(a(i, p), a(i, q));
+            swap(P_[p], P_[q]);
+        };
+
+        const double alfa = (1.0 + sqrt(17.0)) / 8.0;
+        vector<double> w1(n_), w2(n_);
+        int k = 0;
+        while (k < n_) {
+            // wybor Bunch-Kaufmana
+            double absakk = fabs(a(k, k));
+            int imax = k;
+            double colmax = 0.0;
+            for (int i = k + 1; i < n_; i++) {
+                if (fabs(a(i, k)) > colmax) {
+                    colmax = fabs(a(i, k));
+                    imax = i;
+                }
+            }
+            if (max(absakk, colmax) == 0.0) {
+                status_ = StatusRozkladu::Osobliwa;
+                kolumnaBledu_ = k;
+                SLEDZ(ostrzezenie("Rozkład LDL^T: macierz jest osobliwa (kolumna " + to_string(k + 1) + ")"));
+                return;
+            }
+
+            int krok = 1, kp = k;
+            if (absakk < alfa * colmax) {
+                double rowmax = 0.0;
+                for (int j = k; j < n_; j++) {
+                    if (j != imax) rowmax = max(rowmax, fabs(a(imax, j)));
+                }
+                if (absakk >= alfa * colmax * (colmax / rowmax)) {
+                    kp = k;
+                } else if (fabs(a(imax, imax)) >= alfa * rowmax) {
+                    kp = imax;
+                } else {
+                    kp = imax;
+                    krok = 2;
+                }
+            }
+            int kk = k + krok - 1;
+            if (kp != kk) {
+                zamien(kk, kp);
+            }
+
+            if (krok == 1) {
+                double d = a(k, k);
+                for (int i = k + 1; i < n_; i++) w1[i] = a(i, k);
+                for (int i = k + 1; i < n_; i++) {
+                    double li = w1[i] / d;
+                    axpy(i - k, -li, &w1[k + 1], &a(i, k + 1));
+                    a(i, k) = li;
+                }
+            } else {
+                double d11 = a(k, k), d21 = a(k + 1, k), d22 = a(k + 1, k + 1);
+                double wyznacznik = d11 * d22 - d21 * d21;
+                poddiagonalaD_[k] = d21;
+                a(k + 1, k) = 0.0;
+                for (int i = k + 2; i < n_; i++) {
+                    w1[i] = a(i, k);
+                    w2[i] = a(i, k + 1);
+                }
+                for (int i = k + 2; i < n_; i++) {
+                    double l1 = (w1[i] * d22 - w2[i] * d21) / wyznacznik;
+                    double l2 = (w2[i] * d11 - w1[i] * d21) / wyznacznik;
+                    axpy(i - k - 1, -l1, &w1[k + 2], &a(i, k + 2));
+                    axpy(i - k - 1, -l2, &w2[k + 2], &a(i, k + 2));
+                    a(i, k) = l1;
+                    a(i, k + 1) = l2;
+                }
+            }
+            k += krok;
+        }
+    }
+
+    void RozkladLDLT::sprawdzStatus() const {
+        if (status_ != StatusRozkladu::Poprawny) {
+            throw runtime_error("Rozkład LDL^T nie powiódł się: macierz jest osobliwa (kolumna " +
+                                to_string(kolumnaBledu_ + 1) + ")");
+        }
+    }
+
+    RozkladLDLT::Bezwladnosc RozkladLDLT::bezwladnosc() const {
+        sprawdzStatus();
+        Bezwladnosc wynik;
+        auto dodaj = [&wynik](double wartosc) {
+            if (wartosc > 0.0) wynik.dodatnie++;
+            else if (wartosc < 0.0) wynik.ujemne++;
+            else wynik.zerowe++;
+        };
+        for (int k = 0; k < n_; k++) {
+            double d11 = L_[poczatekWiersza(k) + k];
+            if (poczatekBloku2(k)) {
+                double d22 = L_[poczatekWiersza(k + 1) + k + 1];
+                double d21 = poddiagonalaD_[k];
+                double wyznacznik = d11 * d22 - d21 * d21;
+                if (wyznacznik < 0.0) {
+                    wynik.dodatnie++;
+                    wynik.ujemne++;
+                } else {
+                    dodaj(d11 + d22);
+                    dodaj(wyznacznik == 0.0 ? 0.0 : d11 + d22);
+                }
+                k++;
+            } else {
+                dodaj(d11);
+            }
+        }
+        return wynik;
+    }
+
+    bool RozkladLDLT::dodatnioOkreslona() const {
+        if (!poprawny()) {
+            return false;
+        }
+        Bezwladnosc b = bezwladnosc();
+        return b.ujemne == 0 && b.zerowe == 0;
+    }
+
+    vector<double> RozkladLDLT::solve(const vector<double>& b) const {
+        vector<double> x = b;
+        solve_in_place(x);
+        return x;
+    }
+
+    void RozkladLDLT::solve_in_place(vector<double>& b) const {
+        sprawdzStatus();
+        if (b.size() != n_) {
+            throw invalid_argument("Nieprawidłowy rozmiar wektora prawej strony");
+        }
+        vector<double> z(n_);
+        for (int i = 0; i < n_; i++) {
+            z[i] = b[P_[i]];
+        }
+        // L y = P b (jedynki na przekatnej)
+        for (int i = 0; i < n_; i++) {
+            z[i] -= iloczynSkalarny(i, L_.data() + poczatekWiersza(i), z.data());
+        }
+        // D w = y
+        for (int k = 0; k < n_; k++) {
+            double d11 = L_[poczatekWiersza(k) + k];
+            if (poczatekBloku2(k)) {
+                double d22 = L_[poczatekWiersza(k + 1) + k + 1];
+                double d21 = poddiagonalaD_[k];
+                double wyznacznik = d11 * d22 - d21 * d21;
+                double z1 = z[k], z2 = z[k + 1];
+                z[k] = (d22 * z1 - d21 * z2) / wyznacznik;
+                z[k + 1] = (d11 * z2 - d21 * z1) / wyznacznik;
+                k++;
+            } else {
+                z[k] /= d11;
+            }
+        }
+        // L^T x = w
+        for (int i = n_ - 1; i >= 0; i--) {
+            axpy(i, -z[i], L_.data() + poczatekWiersza(i), z.data());
+        }
+        for (int i = 0; i < n_; i++) {
+            b[P_[i]] = z[i];
+        }
+    }
+
+    Macierz RozkladLDLT::solve_many(const Macierz& B) const {
+        sprawdzStatus();
+        if (B.wiersze() != n_) {
+            throw invalid_argument("Nieprawidłowe wymiary macierzy prawych stron");
+        }
+        int m = B.kolumny();
+        Macierz Z(n_, m);
+        for (int i = 0; i < n_; i++) {
+            copy(B.wiersz(P_[i]), B.wiersz(P_[i]) + m, Z.wiersz(i));
+        }
+        for (int i = 0; i < n_; i++) {
+            const double* l_i = L_.data() + poczatekWiersza(i);
+            for (int k = 0; k < i; k++) {
+                axpy(m, -l_i[k], Z.wiersz(k), Z.wiersz(i));
+            }
+        }
+        for (int k = 0; k < n_; k++) {
+            double d11 = L_[poczatekWiersza(k) + k];
+            double* z1 = Z.wiersz(k);
+            if (poczatekBloku2(k)) {
+                double d22 = L_[poczatekWiersza(k + 1) + k + 1];
+                double d21 = poddiagonalaD_[k];
+                double wyznacznik = d11 * d22 - d21 * d21;
+                double* z2 = Z.wiersz(k + 1);
+                for (int j = 0; j < m; j++) {
+                    double a1 = z1[j], a2 = z2[j];
+                    z1[j] = (d22 * a1 - d21 * a2) / wyznacznik;
+                    z2[j] = (d11 * a2 - d21 * a1) / wyznacznik;
+                }
+                k++;
+            } else {
+                for (int j = 0; j < m; j++) {
+                    z1[j] /= d11;
+                }
+            }
+        }
+        for (int i = n_ - 1; i >= 0; i--) {
+            const double* l_i = L_.data() + poczatekWiersza(i);
+            for (int k = 0; k < i; k++) {
+                axpy(m, -l_i[k], Z.wiersz(i), Z.wiersz(k));
+            }
+        }
+        Macierz X(n_, m);
+        for (int i = 0; i < n_; i++) {
+            copy(Z.wiersz(i), Z.wiersz(i) + m, X.wiersz(P_[i]));
+        }
+        return X;
+    }
+
+    vector<vector<double>> RozkladLDLT::solve_many(const vector<vector<double>>& B) const {
+        vector<vector<double>> X = B;
+        for (auto& x : X) {
+            solve_in_place(x);
+        }
+        return X;
+    }
+
+    Macierz RozkladLDLT::czynnikL() const {
+        Macierz L(n_, n_);
+        for (int i = 0; i < n_; i++) {
+            copy(L_.data() + poczatekWiersza(i), L_.data() + poczatekWiersza(i) + i, L.wiersz(i));
+            L(i, i) = 1.0;
+        }
+        return L;
+    }
+
+    Macierz RozkladLDLT::czynnikD() const {
+        Macierz D(n_, n_);
+        for (int k = 0; k < n_; k++) {
+            D(k, k) = L_[poczatekWiersza(k) + k];
+            if (k + 1 < n_ && poddiagonalaD_[k] != 0.0) {
+                D(k + 1, k) = D(k, k + 1) = poddiagonalaD_[k];
+            }
+        }
+        return D;
+    }
+
+    vector<double> metodaThomasa(const vector<double>& pod,
+                                 const vector<double>& glowna,
+                                 const vector<double>& nad,
+                                 const vector<double>& wektor_b) {
+        int n = glowna.size();
+        if (n == 0 || wektor_b.size() != n || pod.size() != n - 1 || nad.size() != n - 1) {
+            throw invalid_argument("Nieprawidłowe wymiary");
+        }
+
+        // eliminacja w przod: c'[i] = nad[i] / m_i, x[i] = (b[i] - pod[i-1] x[i-1]) / m_i
+        vector<double> c(n);
+        vector<double> x(n);
+        double m = glowna[0];
+        for (int i = 0; i < n; i++) {
+            if (i > 0) {
+                m = glowna[i] - pod[i - 1] * c[i - 1];
+            }
+            if (m == 0.0) {
+                throw runtime_error("Zerowy element główny w algorytmie Thomasa (wiersz " + to_string(i + 1) + ")");
+            }
+            c[i] = i < n - 1 ? nad[i] / m : 0.0;
+            x[i] = (wektor_b[i] - (i > 0 ? pod[i - 1] * x[i - 1] : 0.0)) / m;
+        }
+        for (int i = n - 2; i >= 0; i--) {
+            x[i] -= c[i] * x[i + 1];
+        }
+        return x;
+    }
+
+    int metodaThomasaWsadowa(int n, int liczbaUkladow,
+                              const double* pod, const double* glowna, const double* nad,
+                              double* wektory_b) {
+        if (n <= 0 || liczbaUkladow <= 0) {
+            throw invalid_argument("Nieprawidłowe wymiary");
+        }
+        const int m = liczbaUkladow;
+        const int grupa = 256;          // bufor n x grupa
+        vector<double, AlokatorWyrownany<double>> c(static_cast<size_t>(n) * grupa);
+        vector<unsigned char> poprawny(grupa);
+        int osobliwe = 0;
+
+        for (int s0 = 0; s0 < m; s0 += grupa) {
+            int g = min(grupa, m - s0);
+            double* d = wektory_b + s0;
+            const double* a = pod + s0;
+            const double* bb = glowna + s0;
+            const double* cc = nad + s0;
+
+            for (int s = 0; s < g; s++) {
+                double mi = bb[s];
+                poprawny[s] = mi != 0.0;
+                c[s] = n > 1 ? cc[s] / mi : 0.0;
+                d[s] /= mi;
+            }
+            for (int i = 1; i < n; i++) {
+                const double* a_i = a + static_cast<size_t>(i - 1) * m;
+                const double* b_i = bb + static_cast<size_t>(i) * m;
+                double* d_i = d + static_cast<size_t>(i) * m;
+                const double* d_p = d + static_cast<size_t>(i - 1) * m;
+                double* cw = c.data() + static_cast<size_t>(i) * grupa;
+                const double* cw_p = c.data() + static_cast<size_t>(i - 1) * grupa;
+                if (i < n - 1) {
+                    const double* c_i = cc + static_cast<size_t>(i) * m;
+                    for (int s = 0; s < g; s++) {
+                        double mi = b_i[s] - a_i[s] * cw_p[s];
+                        poprawny[s] &= mi != 0.0;
+                        cw[s] = c_i[s] / mi;
+                        d_i[s] = (d_i[s] - a_i[s] * d_p[s]) / mi;
+                    }
+                } else {
+                    for (int s = 0; s < g; s++) {
+                        double mi = b_i[s] - a_i[s] * cw_p[s];
+                        poprawny[s] &= mi != 0.0;
+                        d_i[s] = (d_i[s] - a_i[s] * d_p[s]) / mi;
+                    }
+                }
+            }
+            for (int i = n - 2; i >= 0; i--) {
+                double* d_i = d + static_cast<size_t>(i) * m;
+                const double* d_n = d + static_cast<size_t>(i + 1) * m;
+                const double* cw = c.data() + static_cast<size_t>(i) * grupa;
+                for (int s = 0; s < g; s++) {
+                    d_i[s] -= cw[s] * d_n[s];
+                }
+            }
+
+            // uklady z zerowym elementem glownym: rozwiazanie NaN, pozostale uklady grupy sa poprawne
+            for (int s = 0; s < g; s++) {
+                if (!poprawny[s]) {
+                    osobliwe++;
+                    for (int i = 0; i < n; i++) {
+                        d[static_cast<size_t>(i) * m + s] = numeric_limits<double>::quiet_NaN();
+                    }
+                }
+            }
+        }
+        return osobliwe;
+    }
+
+    void rozkladLU_pasmowy(MacierzPasmowa& A, vector<int>& zamiany) {
+        int n = A.rozmiar();
+        int kl = A.dolna();
+        int szerokoscU = A.gorna() + kl;      // U po zamianach wierszy ma szersze pasmo
+        zamiany.assign(n, 0);
+
+        for (int k = 0; k < n; k++) {
+            int ostatniWiersz = min(n - 1, k + kl);
+            int ostatniaKolumna = min(n - 1, k + szerokoscU);
+
+            int p = k;
+            for (int i = k + 1; i <= ostatniWiersz; i++) {
+                if (fabs(A(i, k)) > fabs(A(p, k))) {
+                    p = i;
+                }
+            }
+            if (fabs(A(p, k)) < 1e-10) {
+                throw runtime_error("Macierz jest osobliwa");
+            }
+            zamiany[k] = p;
+            if (p != k) {
+                // kolumny k..ostatniaKolumna leza w buforze obu wierszy (p <= k + kl)
+                swap_ranges(&A(k, k), &A(k, k) + (ostatniaKolumna - k + 1), &A(p, k));
+            }
+
+            double a_kk = A(k, k);
+            int dlugosc = ostatniaKolumna - k;
+            for (int i = k + 1; i <= ostatniWiersz; i++) {
+                double l = A(i, k) / a_kk;
+                A(i, k) = l;
+                if (l != 0.0 && dlugosc > 0) {
+                    axpy(dlugosc, -l, &A(k, k + 1), &A(i, k + 1));
+                }
+            }
+        }
+    }
+
+    void rozwiazLU_pasmowy(const MacierzPasmowa& LU, const vector<int>& zamiany, vector<double>& wektor_b) {
+        int n = LU.rozmiar();
+        if (wektor_b.size() != n || zamiany.size() != n) {
+            throw invalid_argument("Nieprawidłowe wymiary");
+        }
+        int kl = LU.dolna();
+        int szerokoscU = LU.gorna() + kl;
+
+        // L y = P b, zamiany stosowane w kolejnosci krokow rozkladu
+        for (int k = 0; k < n; k++) {
+            swap(wektor_b[k], wektor_b[zamiany[k]]);
+            for (int i = k + 1; i <= min(n - 1, k + kl); i++) {
+                wektor_b[i] -= LU(i, k) * wektor_b[k];
+            }
+        }
+        // U x = y
+        for (int i = n - 1; i >= 0; i--) {
+            int dlugosc = min(n - 1, i + szerokoscU) - i;
+            double suma = dlugosc > 0 ? iloczynSkalarny(dlugosc, &LU(i, i + 1), &wektor_b[i + 1]) : 0.0;
+            wektor_b[i] = (wektor_b[i] - suma) / LU(i, i);
+        }
+    }
+
+    vector<double> rozwiazUkladPasmowy(const MacierzPasmowa& A, const vector<double>& wektor_b) {
+        if (wektor_b.size() != A.rozmiar()) {
+            throw invalid_argument("Nieprawidłowe wymiary");
+        }
+        MacierzPasmowa LU = A;
+        vector<int> zamiany;
+        rozkladLU_pasmowy(LU, zamiany);
+        vector<double> x = wektor_b;
+        rozwiazLU_pasmowy(LU, zamiany, x);
+        return x;
+    }
 
     void testUkladu(const string& nazwaPliku) {
-        vector<vector<double>> A;
+        // test ma pokazac przebieg obliczen, wiec wlaczamy wypisywanie na konsole
+        SledzenieKonsola konsola;
+        ZakresSledzenia zakres(&konsola);
+
+        Macierz A;
         vector<double> b;
         int N;
 
@@ -426,4 +2835,4 @@ vector<double> rozwiazUklad(const vector<vector<double>>& macierzSchodkowa) {
         double maxBled = sprawdzPoprawnosc(A, wynik.second, b);
     }
 
-}
\ No newline at end of file
+}
@@ -0,0 +1,28 @@
+//
+// Created by Szymon Ros on 17/10/2026.
+//
+#include "../include/uklady_male.h"
+#include <stdexcept>
+#include <utility>
+
+using namespace std;
+
+namespace biblioteka_numeryczna {
+    // tablica wskaznikow na instancje szablonu dla n = 1..16
+    template <int... N>
+    static int wybierzRozmiar(int n, int liczbaUkladow, double* A, double* b, integer_sequence<int, N...>) {
+        using Funkcja = int (*)(int, double*, double*);
+        static const Funkcja instancje[] = {&rozwiazUkladyWsadowo<N + 1>...};
+        return instancje[n - 1](liczbaUkladow, A, b);
+    }
+
+    int rozwiazUkladyWsadowo(int n, int liczbaUkladow, double* A, double* b) {
+        if (n < 1 || n > 16) {
+            throw invalid_argument("Obsługiwane rozmiary układów: 1..16");
+        }
+        if (liczbaUkladow < 0) {
+            throw invalid_argument("Liczba układów nie może być ujemna");
+        }
+        return wybierzRozmiar(n, liczbaUkladow, A, b, make_integer_sequence<int, 16>());
+    }
+}
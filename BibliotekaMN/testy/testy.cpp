@@ -13,6 +13,9 @@
 #include <cassert>
 #include <iomanip>
 #include <fstream>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
 
 using namespace std;
 using namespace biblioteka_numeryczna;
@@ -98,6 +101,42 @@ void testMetodaGaussaSeidela2() {
     wypiszWynikTestu("metodaGaussaSeidela - test 2", test2);
 }
 
+void testMetodaGaussaSeidela3() {
+    // Test 3: kryterium kroku faktycznie działa - więcej niż jedna iteracja, zgodność z CSR
+    Macierz A = {{4, -1, 0, 1}, {-1, 4, -1, 0}, {0, -1, 4, -1}, {1, 0, -1, 4}};
+    vector<double> b = {1, 2, 3, 4}, x0(4, 0.0);
+
+    RaportZbieznosci gesty = metodaGaussaSeidela(A, b, x0, KryteriumZbieznosci{0.0, 0.0, 1000, 1e-12});
+    RaportZbieznosci rzadki = metodaGaussaSeidela(MacierzRzadkaCSR::zGestej(A), b, x0, KryteriumZbieznosci{0.0, 0.0, 1000, 1e-12});
+    vector<double> x = metodaGaussaSeidela(A, b, x0, 1e-12);
+
+    bool test3 = gesty.iteracje > 5 && gesty.iteracje < 1000 && gesty.zbiezny &&
+                 gesty.iteracje == rzadki.iteracje && gesty.residuum < 1e-10 &&
+                 porownajDouble(x[2], gesty.x[2], 1e-15) && porownajDouble(rzadki.x[3], gesty.x[3], 1e-12);
+    wypiszWynikTestu("metodaGaussaSeidela - test 3 (kryterium kroku)", test3);
+}
+
+void testMetodaGaussaSeidela4() {
+    // Test 4: kryterium residuum względnego, historia malejąca, telemetria czasu
+    int n = 60;
+    Macierz A(n, n);
+    for (int i = 0; i < n; i++) {
+        A(i, i) = 3.0;
+        if (i > 0) A(i, i - 1) = -1.0;
+        if (i < n - 1) A(i, i + 1) = -1.0;
+    }
+    vector<double> b(n, 1.0);
+    RaportZbieznosci wynik = metodaGaussaSeidela(A, b, vector<double>(n, 0.0), KryteriumZbieznosci{1e-9, 0.0, 500});
+
+    bool malejaca = true;
+    for (size_t k = 1; k < wynik.historiaResiduum.size(); k++) {
+        malejaca = malejaca && wynik.historiaResiduum[k] <= wynik.historiaResiduum[k - 1];
+    }
+    bool test4 = wynik.zbiezny && malejaca && wynik.historiaResiduum.size() == wynik.iteracje &&
+                 wynik.residuumWzgledne <= 1e-9 && wynik.czasNaIteracje >= 0.0;
+    wypiszWynikTestu("metodaGaussaSeidela - test 4 (residuum względne)", test4);
+}
+
 void testRozkladLU1() {
     // Test 1:  2x2
     vector<vector<double>> A = {{2, 1}, {1, 1}};
@@ -123,6 +162,1431 @@ void testRozkladLU2() {
     wypiszWynikTestu("rozkladLU_zPivotingiem - test 2 (struktura)", test2);
 }
 
+void testRozkladLUBlokowy1() {
+    // Test 1: te same L, U, P co rozkladLU_zPivotingiem (blok mniejszy niż macierz)
+    vector<vector<double>> A = {{1, 2, 3, 4, 5}, {2, 7, 1, 8, 2}, {8, 1, 8, 2, 8},
+                                {4, 5, 9, 0, 4}, {5, 3, 6, 2, 1}};
+    vector<vector<double>> L1, U1, L2, U2;
+    vector<int> P1, P2;
+
+    rozkladLU_zPivotingiem(A, L1, U1, P1);
+    rozkladLU_blokowy(A, L2, U2, P2, 2);
+
+    bool test1 = P1 == P2;
+    for (int i = 0; i < 5; i++) {
+        for (int j = 0; j < 5; j++) {
+            test1 = test1 && porownajDouble(L1[i][j], L2[i][j], 1e-12);
+            if (j >= i) {
+                test1 = test1 && porownajDouble(U1[i][j], U2[i][j], 1e-12);
+            }
+        }
+    }
+    wypiszWynikTestu("rozkladLU_blokowy - test 1 (zgodność z rozkladLU_zPivotingiem)", test1);
+}
+
+void testRozkladLUBlokowy2() {
+    // Test 2: P*A = L*U dla większej macierzy i rozmiaru bloku nie dzielącego n
+    int n = 37;
+    Macierz A(n, n);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            A(i, j) = sin(i * 1.3 + j * 0.7) + (i == j ? 2.0 : 0.0);
+        }
+    }
+    Macierz L, U;
+    vector<int> P;
+    rozkladLU_blokowy(A, L, U, P, 8);
+
+    double maxBlad = 0.0;
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            double suma = 0.0;
+            for (int k = 0; k < n; k++) {
+                suma += L(i, k) * U(k, j);
+            }
+            maxBlad = max(maxBlad, abs(suma - A(P[i], j)));
+        }
+    }
+    bool test2 = maxBlad < 1e-10;
+    wypiszWynikTestu("rozkladLU_blokowy - test 2 (P*A = L*U)", test2);
+}
+
+void testRozkladLURownolegly1() {
+    // Test 1: wynik identyczny z rozkladLU_blokowy (kilka kafelków, rozmiar nie dzielący n)
+    int n = 45;
+    Macierz A(n, n);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            A(i, j) = cos(i * 0.9 - j * 1.7) + (i == j ? 1.0 : 0.0);
+        }
+    }
+    Macierz L1, U1, L2, U2;
+    vector<int> P1, P2;
+    rozkladLU_blokowy(A, L1, U1, P1, 8);
+    rozkladLU_rownolegly(A, L2, U2, P2, 4, 8);
+
+    bool test1 = P1 == P2;
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            test1 = test1 && porownajDouble(L1(i, j), L2(i, j), 1e-12) && porownajDouble(U1(i, j), U2(i, j), 1e-12);
+        }
+    }
+    wypiszWynikTestu("rozkladLU_rownolegly - test 1 (zgodność z rozkladLU_blokowy)", test1);
+}
+
+void testRozkladLURownolegly2() {
+    // Test 2: macierz osobliwa - wyjątek z zadania przekazany do wywołującego
+    Macierz A = {{1, 2, 3}, {2, 4, 6}, {1, 1, 1}};
+    Macierz L, U;
+    vector<int> P;
+    bool test2 = false;
+    try {
+        rozkladLU_rownolegly(A, L, U, P, 2, 1);
+    } catch (const runtime_error&) {
+        test2 = true;
+    }
+    wypiszWynikTestu("rozkladLU_rownolegly - test 2 (macierz osobliwa)", test2);
+}
+
+void testJadraSimd1() {
+    // Test 1: każda obsługiwana ścieżka daje ten sam axpy i iloczyn skalarny (także z końcówką)
+    int n = 37;
+    vector<double> x(n), y(n);
+    for (int i = 0; i < n; i++) {
+        x[i] = sin(i * 0.3);
+        y[i] = cos(i * 0.7);
+    }
+    double oczekiwanyIloczyn = 0.0;
+    for (int i = 0; i < n; i++) {
+        oczekiwanyIloczyn += x[i] * y[i];
+    }
+
+    bool test1 = true;
+    for (SciezkaSimd sciezka : {SciezkaSimd::Skalarna, SciezkaSimd::AVX2, SciezkaSimd::AVX512}) {
+        wymusSciezkeSimd(sciezka);
+        vector<double> z = y;
+        axpy(n, 2.5, x.data(), z.data());
+        for (int i = 0; i < n; i++) {
+            test1 = test1 && porownajDouble(z[i], y[i] + 2.5 * x[i], 1e-12);
+        }
+        test1 = test1 && porownajDouble(iloczynSkalarny(n, x.data(), y.data()), oczekiwanyIloczyn, 1e-12);
+    }
+    SciezkaSimd wybrana = wymusSciezkeSimd(SciezkaSimd::AVX512);
+    cout << "Ścieżka jąder SIMD: " << nazwaSciezkiSimd(wybrana) << endl;
+    wypiszWynikTestu("jadra SIMD - test 1 (zgodność ścieżek)", test1);
+}
+
+void testJadraSimd2() {
+    // Test 2: podstawianie wstecz na macierzy trójkątnej
+    Macierz U = {{2, 1, -1}, {0, 3, 2}, {0, 0, 4}};
+    vector<double> b = {1, 11, 8};
+    vector<double> x = b;
+    podstawianieWstecz(U, x.data());
+    vector<double> Ux = pomnoz(U, x);
+
+    bool test2 = porownajDouble(Ux[0], b[0]) && porownajDouble(Ux[1], b[1]) && porownajDouble(Ux[2], b[2]);
+    wypiszWynikTestu("jadra SIMD - test 2 (podstawianie wstecz)", test2);
+}
+
+void testRozkladLUObiekt1() {
+    // Test 1: solve zgodne z eliminacjaGaussa dla kilku prawych stron
+    vector<vector<double>> A = {{1, 2, 3}, {2, -1, 1}, {3, 0, -1}};
+    RozkladLU lu(A);
+
+    bool test1 = true;
+    for (vector<double> b : {vector<double>{9, 8, 3}, vector<double>{1, 0, 0}, vector<double>{-2, 5, 7}}) {
+        vector<vector<double>> kopiaA = A;
+        vector<double> kopiaB = b;
+        vector<double> oczekiwane = eliminacjaGaussa(kopiaA, kopiaB);
+        vector<double> x = lu.solve(b);
+        for (int i = 0; i < 3; i++) {
+            test1 = test1 && porownajDouble(x[i], oczekiwane[i], 1e-10);
+        }
+    }
+    wypiszWynikTestu("RozkladLU - test 1 (solve)", test1);
+}
+
+void testRozkladLUObiekt2() {
+    // Test 2: solve_many i solve_in_place dają to samo co solve
+    Macierz A = {{4, -2, 1, 0}, {3, 6, -4, 2}, {2, 1, 8, -5}, {1, 0, 2, 7}};
+    RozkladLU lu(A);
+    Macierz B = {{1, 0}, {2, 1}, {3, 0}, {4, -1}};
+
+    Macierz X = lu.solve_many(B);
+    bool test2 = true;
+    for (int j = 0; j < 2; j++) {
+        vector<double> b = {B(0, j), B(1, j), B(2, j), B(3, j)};
+        vector<double> x = lu.solve(b);
+        lu.solve_in_place(b);
+        for (int i = 0; i < 4; i++) {
+            test2 = test2 && porownajDouble(X(i, j), x[i], 1e-12) && porownajDouble(b[i], x[i], 1e-12);
+        }
+    }
+    wypiszWynikTestu("RozkladLU - test 2 (solve_many, solve_in_place)", test2);
+}
+
+// odbiorca liczący zgłoszenia, do testów śledzenia
+class SledzenieLiczace : public Sledzenie {
+public:
+    int liczba = 0;
+    void komunikat(const string&) override { liczba++; }
+    void ostrzezenie(const string&) override { liczba++; }
+    void macierz(const Macierz&, const string&) override { liczba++; }
+    void wektor(const vector<double>&, const string&) override { liczba++; }
+};
+
+void testSledzenie1() {
+    // Test 1: włączony odbiorca dostaje zgłoszenia z rozkładu LU
+    SledzenieLiczace liczace;
+    Sledzenie* poprzednie = ustawSledzenie(&liczace);
+
+    vector<vector<double>> A = {{1, 2}, {3, 4}};
+    vector<vector<double>> L, U;
+    vector<int> P;
+    rozkladLU_zPivotingiem(A, L, U, P);
+    ustawSledzenie(poprzednie);
+
+#ifdef BIBLIOTEKA_MN_BEZ_SLEDZENIA
+    bool test1 = liczace.liczba == 0;
+#else
+    bool test1 = liczace.liczba > 0;
+#endif
+    wypiszWynikTestu("Sledzenie - test 1 (zgłoszenia z rozkładu LU)", test1);
+}
+
+void testSledzenie2() {
+    // Test 2: domyślnie aktywny jest odbiorca pusty
+    ustawSledzenie(nullptr);
+    bool test2 = !sledzenie().wlaczone();
+    wypiszWynikTestu("Sledzenie - test 2 (domyślnie wyłączone)", test2);
+}
+
+// macierz Poissona 1D (tridiagonalna 2, -1) w formacie CSR
+MacierzRzadkaCSR macierzPoissona1D(int n) {
+    vector<Trojka> trojki;
+    for (int i = 0; i < n; i++) {
+        trojki.push_back({i, i, 2.0});
+        if (i > 0) trojki.push_back({i, i - 1, -1.0});
+        if (i < n - 1) trojki.push_back({i, i + 1, -1.0});
+    }
+    return MacierzRzadkaCSR::zTrojek(n, n, trojki);
+}
+
+void testMacierzRzadka1() {
+    // Test 1: budowa z trójek (z sumowaniem powtórzeń) i z macierzy gęstej daje to samo
+    vector<Trojka> trojki = {{1, 0, 2}, {0, 0, 4}, {0, 2, 1}, {1, 0, 1}, {2, 2, 5}};
+    MacierzRzadkaCSR A = MacierzRzadkaCSR::zTrojek(3, 3, trojki);
+    MacierzRzadkaCSR B = MacierzRzadkaCSR::zGestej(vector<vector<double>>{{4, 0, 1}, {3, 0, 0}, {0, 0, 5}});
+
+    vector<double> y = pomnoz(A, {1, 2, 3});
+    bool test1 = A.liczbaNiezerowych() == 4 && A.element(1, 0) == 3 &&
+                 A.poczatkiWierszy() == B.poczatkiWierszy() && A.indeksyKolumn() == B.indeksyKolumn() &&
+                 A.wartosci() == B.wartosci() &&
+                 porownajDouble(y[0], 7) && porownajDouble(y[1], 3) && porownajDouble(y[2], 15);
+    wypiszWynikTestu("MacierzRzadkaCSR - test 1 (budowa i mnożenie)", test1);
+}
+
+void testMacierzRzadka2() {
+    // Test 2: Gauss-Seidel, Jacobi i SOR na macierzy rzadkiej zbiegają do rozwiązania
+    int n = 20;
+    MacierzRzadkaCSR A = macierzPoissona1D(n);
+    vector<double> xDokladne(n);
+    for (int i = 0; i < n; i++) {
+        xDokladne[i] = sin(i * 0.2);
+    }
+    vector<double> b = pomnoz(A, xDokladne);
+    vector<double> x0(n, 0.0);
+
+    vector<double> xGS = metodaGaussaSeidela(A, b, x0, 1e-12, 20000);
+    vector<double> xJ = metodaJacobiego(A, b, x0, 1e-12, 40000);
+    vector<double> xSOR = metodaSOR(A, b, x0, 1.7, 1e-12, 20000);
+
+    bool test2 = true;
+    for (int i = 0; i < n; i++) {
+        test2 = test2 && porownajDouble(xGS[i], xDokladne[i], 1e-6) &&
+                porownajDouble(xJ[i], xDokladne[i], 1e-6) && porownajDouble(xSOR[i], xDokladne[i], 1e-6);
+    }
+    wypiszWynikTestu("MacierzRzadkaCSR - test 2 (Gauss-Seidel, Jacobi, SOR)", test2);
+}
+
+// macierz Poissona 2D (5-punktowa) na siatce m x m w formacie CSR
+MacierzRzadkaCSR macierzPoissona2D(int m) {
+    vector<Trojka> trojki;
+    for (int i = 0; i < m; i++) {
+        for (int j = 0; j < m; j++) {
+            int k = i * m + j;
+            trojki.push_back({k, k, 4.0});
+            if (i > 0) trojki.push_back({k, k - m, -1.0});
+            if (i < m - 1) trojki.push_back({k, k + m, -1.0});
+            if (j > 0) trojki.push_back({k, k - 1, -1.0});
+            if (j < m - 1) trojki.push_back({k, k + 1, -1.0});
+        }
+    }
+    return MacierzRzadkaCSR::zTrojek(m * m, m * m, trojki);
+}
+
+void testGradientySprzezone1() {
+    // Test 1: CG bez prekondycjonowania na macierzy Poissona 2D osiąga tolerancję względną
+    MacierzRzadkaCSR A = macierzPoissona2D(12);
+    int n = A.wiersze();
+    vector<double> b(n, 1.0);
+
+    RaportZbieznosci wynik = metodaGradientowSprzezonych(A, b, vector<double>(n, 0.0), {1e-10, 0.0, 1000});
+    vector<double> Ax = pomnoz(A, wynik.x);
+    double maxBlad = 0.0;
+    for (int i = 0; i < n; i++) {
+        maxBlad = max(maxBlad, abs(Ax[i] - b[i]));
+    }
+    bool test1 = wynik.zbiezny && maxBlad < 1e-8 &&
+                 wynik.historiaResiduum.size() == wynik.iteracje + 1;
+    wypiszWynikTestu("metodaGradientowSprzezonych - test 1 (Poisson 2D)", test1);
+}
+
+void testGradientySprzezone2() {
+    // Test 2: prekondycjonery skracają iterację, wynik zgodny z macierzą gęstą
+    MacierzRzadkaCSR A = macierzPoissona2D(12);
+    int n = A.wiersze();
+    vector<double> b(n, 1.0), x0(n, 0.0);
+    KryteriumZbieznosci kryterium{1e-10, 0.0, 1000};
+
+    RaportZbieznosci bez = metodaGradientowSprzezonych(A, b, x0, kryterium);
+    RaportZbieznosci jacobi = metodaGradientowSprzezonych(A, b, x0, kryterium, prekondycjonerJacobiego(A));
+    RaportZbieznosci ssor = metodaGradientowSprzezonych(A, b, x0, kryterium, prekondycjonerSSOR(A, 1.5));
+    RaportZbieznosci ic = metodaGradientowSprzezonych(A, b, x0, kryterium, prekondycjonerCholeskyNiepelny(A));
+    Macierz gesta = A.doGestej();
+    RaportZbieznosci zGestej = metodaGradientowSprzezonych(gesta, b, x0, kryterium);
+
+    bool test2 = jacobi.zbiezny && ssor.zbiezny && ic.zbiezny &&
+                 ssor.iteracje < bez.iteracje && ic.iteracje < bez.iteracje &&
+                 zGestej.iteracje == bez.iteracje && porownajDouble(zGestej.x[7], ic.x[7], 1e-8);
+    wypiszWynikTestu("metodaGradientowSprzezonych - test 2 (prekondycjonery)", test2);
+}
+
+// niesymetryczna macierz konwekcji-dyfuzji 1D (bez dominacji przekątniowej dla dużego peclet)
+MacierzRzadkaCSR macierzKonwekcjiDyfuzji(int n, double peclet) {
+    vector<Trojka> trojki;
+    for (int i = 0; i < n; i++) {
+        trojki.push_back({i, i, 2.0});
+        if (i > 0) trojki.push_back({i, i - 1, -1.0 - peclet});
+        if (i < n - 1) trojki.push_back({i, i + 1, -1.0 + peclet});
+    }
+    return MacierzRzadkaCSR::zTrojek(n, n, trojki);
+}
+
+void testKrylow1() {
+    // Test 1: GMRES(m) i BiCGSTAB na układzie niesymetrycznym
+    MacierzRzadkaCSR A = macierzKonwekcjiDyfuzji(200, 0.7);
+    int n = A.wiersze();
+    vector<double> x_dokladne(n), x0(n, 0.0);
+    for (int i = 0; i < n; i++) {
+        x_dokladne[i] = sin(0.05 * i);
+    }
+    vector<double> b = pomnoz(A, x_dokladne);
+    KryteriumZbieznosci kryterium{1e-10, 0.0, 5000};
+
+    RaportZbieznosci gmres = metodaGMRES(A, b, x0, 20, kryterium);
+    RaportZbieznosci bicgstab = metodaBiCGSTAB(A, b, x0, kryterium);
+    double bladG = 0.0, bladB = 0.0;
+    for (int i = 0; i < n; i++) {
+        bladG = max(bladG, abs(gmres.x[i] - x_dokladne[i]));
+        bladB = max(bladB, abs(bicgstab.x[i] - x_dokladne[i]));
+    }
+    bool test1 = gmres.zbiezny && bicgstab.zbiezny && bladG < 1e-6 && bladB < 1e-6 &&
+                 gmres.residuumWzgledne <= 1e-10 * 1.01;
+    wypiszWynikTestu("metodaGMRES/BiCGSTAB - test 1 (konwekcja-dyfuzja)", test1);
+}
+
+void testKrylow2() {
+    // Test 2: operator bez macierzy, prekondycjonowanie i wspólny raport z Gaussem-Seidelem
+    int n = 50;
+    OperatorLiniowy A = [n](const vector<double>& x, vector<double>& y) {
+        y.resize(n);
+        for (int i = 0; i < n; i++) {
+            y[i] = (i + 2.0) * x[i] + (i + 1 < n ? x[i + 1] : 0.0) - 0.5 * (i > 0 ? x[i - 1] : 0.0);
+        }
+    };
+    vector<double> b(n, 1.0), x0(n, 0.0);
+    KryteriumZbieznosci kryterium{1e-12, 0.0, 1000};
+    Prekondycjoner M = [n](const vector<double>& r, vector<double>& z) {
+        z.resize(n);
+        for (int i = 0; i < n; i++) z[i] = r[i] / (i + 2.0);
+    };
+
+    RaportZbieznosci bez = metodaGMRES(A, b, x0, 5, kryterium);
+    RaportZbieznosci z = metodaGMRES(A, b, x0, 5, kryterium, M);
+    RaportZbieznosci bicg = metodaBiCGSTAB(A, b, x0, kryterium, M);
+
+    MacierzRzadkaCSR P = macierzPoissona2D(6);
+    vector<double> bP(P.wiersze(), 1.0);
+    RaportZbieznosci gs = metodaGaussaSeidela(P, bP, vector<double>(P.wiersze(), 0.0), {1e-8, 0.0, 1000});
+
+    bool test2 = bez.zbiezny && z.zbiezny && bicg.zbiezny && z.iteracje <= bez.iteracje &&
+                 porownajDouble(z.x[10], bicg.x[10], 1e-9) &&
+                 gs.zbiezny && gs.residuumWzgledne < 1e-7 && gs.historiaResiduum.size() == gs.iteracje;
+    wypiszWynikTestu("metodaGMRES/BiCGSTAB - test 2 (operator, prekondycjoner)", test2);
+}
+
+void testSORAdaptacyjna1() {
+    // Test 1: Poisson 2D - kilkukrotnie mniej przebiegów niż Gauss-Seidel, omega blisko optymalnego
+    int m = 30;
+    MacierzRzadkaCSR A = macierzPoissona2D(m);
+    int n = A.wiersze();
+    vector<double> b(n, 1.0), x0(n, 0.0);
+    KryteriumZbieznosci kryterium{1e-8, 0.0, 20000};
+
+    RaportZbieznosci gs = metodaGaussaSeidela(A, b, x0, kryterium);
+    RaportSOR sor = metodaSORAdaptacyjna(A, b, x0, kryterium);
+    double omegaTeoretyczne = 2.0 / (1.0 + sin(M_PI / (m + 1)));
+
+    bool test1 = gs.zbiezny && sor.zbiezny && sor.residuumWzgledne <= 1e-8 &&
+                 sor.iteracje * 5 < gs.iteracje && abs(sor.omega - omegaTeoretyczne) < 0.05 &&
+                 sor.historiaOmega.size() == sor.iteracje;
+    wypiszWynikTestu("metodaSORAdaptacyjna - test 1 (Poisson 2D)", test1);
+}
+
+void testSORAdaptacyjna2() {
+    // Test 2: macierz gęsta daje ten sam przebieg co CSR
+    int n = 40;
+    Macierz A(n, n);
+    for (int i = 0; i < n; i++) {
+        A(i, i) = 2.0;
+        if (i > 0) A(i, i - 1) = -1.0;
+        if (i < n - 1) A(i, i + 1) = -1.0;
+    }
+    vector<double> b(n, 1.0), x0(n, 0.0);
+    KryteriumZbieznosci kryterium{1e-10, 0.0, 20000};
+
+    RaportSOR gesta = metodaSORAdaptacyjna(A, b, x0, kryterium);
+    RaportSOR rzadka = metodaSORAdaptacyjna(MacierzRzadkaCSR::zGestej(A), b, x0, kryterium);
+    bool test2 = gesta.zbiezny && gesta.iteracje == rzadka.iteracje &&
+                 porownajDouble(gesta.omega, rzadka.omega, 1e-12) &&
+                 gesta.omega > 1.5 && gesta.omega < 2.0 &&
+                 porownajDouble(gesta.x[n / 2], rzadka.x[n / 2], 1e-7) &&
+                 abs(gesta.omega - 2.0 / (1.0 + sin(M_PI / (n + 1)))) < 0.05;
+    wypiszWynikTestu("metodaSORAdaptacyjna - test 2 (gęsta i CSR)", test2);
+}
+
+void testGaussSeidelKolorowy1() {
+    // Test 1: czerwono-czarny GS na siatce 2D zgadza się z GS w kolejności kolorów, niezależnie od liczby wątków
+    int m = 40;
+    MacierzRzadkaCSR A = macierzPoissona2D(m);
+    int n = A.wiersze();
+    vector<double> b(n, 1.0), x0(n, 0.0);
+    vector<int> kolory = kolorowanieCzerwonoCzarne(m, m);
+
+    PulaWatkow jeden(1), cztery(4);
+    vector<double> x1 = metodaGaussaSeidelaKolorowa(A, b, x0, kolory, jeden, 1e-12, 20);
+    vector<double> x4 = metodaGaussaSeidelaKolorowa(A, b, x0, kolory, cztery, 1e-12, 20);
+
+    // ten sam przebieg sekwencyjnie: najpierw wszystkie wiersze czerwone, potem czarne
+    vector<int> kolejnosc;
+    for (int k = 0; k < 2; k++)
+        for (int i = 0; i < n; i++)
+            if (kolory[i] == k) kolejnosc.push_back(i);
+    vector<double> x = x0;
+    for (int it = 0; it < 20; it++) {
+        for (int i : kolejnosc) {
+            double suma = b[i];
+            for (int p = A.poczatkiWierszy()[i]; p < A.poczatkiWierszy()[i + 1]; p++)
+                if (A.indeksyKolumn()[p] != i) suma -= A.wartosci()[p] * x[A.indeksyKolumn()[p]];
+            x[i] = suma / A.element(i, i);
+        }
+    }
+    bool test1 = poprawneKolorowanie(A, kolory) && x1 == x4;
+    for (int i = 0; i < n && test1; i++) {
+        test1 = porownajDouble(x1[i], x[i], 1e-12);
+    }
+    wypiszWynikTestu("metodaGaussaSeidelaKolorowa - test 1 (czerwono-czarny)", test1);
+}
+
+void testGaussSeidelKolorowy2() {
+    // Test 2: kolorowanie zachłanne ogólnego wzorca, zbieżność do rozwiązania
+    int n = 300;
+    vector<Trojka> trojki;
+    for (int i = 0; i < n; i++) {
+        trojki.push_back({i, i, 10.0});
+        trojki.push_back({i, (i * 7 + 3) % n, 1.0});
+        trojki.push_back({(i * 13 + 5) % n, i, -2.0});
+    }
+    MacierzRzadkaCSR A = MacierzRzadkaCSR::zTrojek(n, n, trojki);
+    vector<double> x_dokladne(n);
+    for (int i = 0; i < n; i++) x_dokladne[i] = cos(0.1 * i);
+    vector<double> b = pomnoz(A, x_dokladne);
+
+    vector<int> kolory = kolorowanieZachlanne(A);
+    vector<double> x = metodaGaussaSeidelaKolorowa(A, b, vector<double>(n, 0.0), kolory, 1e-12, 500, 3);
+    double maxBlad = 0.0;
+    for (int i = 0; i < n; i++) maxBlad = max(maxBlad, abs(x[i] - x_dokladne[i]));
+
+    bool wyjatek = false;
+    try {
+        metodaGaussaSeidelaKolorowa(A, b, vector<double>(n, 0.0), vector<int>(n, 0), 1e-12, 1, 1);
+    } catch (const invalid_argument&) {
+        wyjatek = true;
+    }
+    bool test2 = poprawneKolorowanie(A, kolory) && maxBlad < 1e-10 && wyjatek;
+    wypiszWynikTestu("metodaGaussaSeidelaKolorowa - test 2 (kolorowanie zachłanne)", test2);
+}
+
+void testUkladyPasmowe1() {
+    // Test 1: algorytm Thomasa i wersja wsadowa dają to samo co eliminacja Gaussa
+    int n = 7;
+    vector<double> pod(n - 1), glowna(n), nad(n - 1), b(n);
+    Macierz A(n, n);
+    for (int i = 0; i < n; i++) {
+        glowna[i] = 4.0 + i;
+        b[i] = i - 2.0;
+        A(i, i) = glowna[i];
+        if (i < n - 1) {
+            pod[i] = -1.0 - 0.1 * i;
+            nad[i] = 1.5;
+            A(i + 1, i) = pod[i];
+            A(i, i + 1) = nad[i];
+        }
+    }
+    vector<double> x = metodaThomasa(pod, glowna, nad, b);
+    vector<double> b_kopia = b;
+    vector<double> x_gauss = eliminacjaGaussa(A, b_kopia);
+
+    // 1000 układów (niepełna ostatnia grupa), układ s to powyższy przeskalowany przez (s + 1)
+    int m = 1000;
+    vector<double> podW((n - 1) * m), glownaW(n * m), nadW((n - 1) * m), bW(n * m);
+    for (int s = 0; s < m; s++) {
+        for (int i = 0; i < n; i++) {
+            glownaW[i * m + s] = glowna[i] * (s + 1);
+            bW[i * m + s] = b[i];
+            if (i < n - 1) {
+                podW[i * m + s] = pod[i] * (s + 1);
+                nadW[i * m + s] = nad[i] * (s + 1);
+            }
+        }
+    }
+    // układ 500 ma zerowy element główny w pierwszym wierszu - tylko on dostaje NaN
+    glownaW[0 * m + 500] = 0.0;
+    int osobliwe = metodaThomasaWsadowa(n, m, podW.data(), glownaW.data(), nadW.data(), bW.data());
+
+    bool test1 = true;
+    bool testWsadowy = osobliwe == 1 && isnan(bW[3 * m + 500]) && !isnan(bW[3 * m + 499]) && !isnan(bW[3 * m + 501]);
+    for (int i = 0; i < n; i++) {
+        test1 = test1 && porownajDouble(x[i], x_gauss[i], 1e-12);
+        testWsadowy = testWsadowy && porownajDouble(bW[i * m + 0], x[i], 1e-12) &&
+                      porownajDouble(bW[i * m + 999] * 1000.0, x[i], 1e-12);
+    }
+    wypiszWynikTestu("metodaThomasa - test 1 (zgodność z eliminacjaGaussa)", test1);
+    wypiszWynikTestu("metodaThomasaWsadowa - test 1 (1000 układów, osobliwy układ 500)", testWsadowy);
+}
+
+void testUkladyPasmowe2() {
+    // Test 2: pasmowy LU z wyborem elementu (mała przekątna wymusza zamiany wierszy)
+    int n = 40, kl = 2, ku = 3;
+    MacierzPasmowa A(n, kl, ku);
+    for (int i = 0; i < n; i++) {
+        for (int j = max(0, i - kl); j <= min(n - 1, i + ku); j++) {
+            A(i, j) = (i == j) ? 1e-3 : sin(1.0 + i + 2.0 * j);
+        }
+    }
+    vector<double> x_dokladne(n);
+    for (int i = 0; i < n; i++) x_dokladne[i] = 1.0 + 0.5 * i;
+    vector<double> b = pomnoz(A, x_dokladne);
+
+    vector<double> x = rozwiazUkladPasmowy(A, b);
+    MacierzPasmowa LU = A;
+    vector<int> zamiany;
+    rozkladLU_pasmowy(LU, zamiany);
+    bool zamieniono = false;
+    for (int k = 0; k < n; k++) zamieniono = zamieniono || zamiany[k] != k;
+
+    Macierz gesta = A.doGestej();
+    MacierzPasmowa zGestej = MacierzPasmowa::zGestej(gesta);
+
+    bool test2 = true;
+    for (int i = 0; i < n; i++) {
+        test2 = test2 && porownajDouble(x[i], x_dokladne[i], 1e-9);
+    }
+    bool testZGestej = zGestej.dolna() == kl && zGestej.gorna() == ku &&
+                       porownajDouble(zGestej.element(5, 8), A(5, 8)) && zGestej.element(0, 10) == 0.0;
+    wypiszWynikTestu("rozwiazUkladPasmowy - test 1 (mała przekątna)", test2);
+    wypiszWynikTestu("rozkladLU_pasmowy - test 1 (zamiany wierszy)", zamieniono);
+    wypiszWynikTestu("MacierzPasmowa::zGestej - test 1 (szerokość pasma)", testZGestej);
+}
+
+void testRozkladCholeskyego1() {
+    // Test 1: macierz Grama bazy jednomianów (SPD), rozkład blokowy = nieblokowy, wiele prawych stron
+    int k = 6;
+    Macierz G(k, k);
+    for (int i = 0; i < k; i++) {
+        for (int j = 0; j < k; j++) {
+            G(i, j) = iloczynSkalarnyElementowZBazy(i, j, -1.0, 1.0, 1000) + (i == j ? 1.0 : 0.0);
+        }
+    }
+    RozkladCholeskyego blokowy(G, 4), jednoblokowy(G, 64);
+    Macierz L1 = blokowy.czynnikL(), L2 = jednoblokowy.czynnikL();
+
+    Macierz B(k, 3);
+    for (int i = 0; i < k; i++) {
+        B(i, 0) = 1.0;
+        B(i, 1) = i;
+        B(i, 2) = sin(i);
+    }
+    Macierz X = blokowy.solve_many(B);
+
+    bool test1 = blokowy.poprawny() && jednoblokowy.poprawny();
+    for (int i = 0; i < k; i++) {
+        for (int j = 0; j <= i; j++) {
+            double LLt = 0.0;
+            for (int p = 0; p <= j; p++) LLt += L1(i, p) * L1(j, p);
+            test1 = test1 && porownajDouble(LLt, G(i, j), 1e-12) && porownajDouble(L1(i, j), L2(i, j), 1e-13);
+        }
+        for (int c = 0; c < 3; c++) {
+            double suma = 0.0;
+            for (int j = 0; j < k; j++) suma += G(i, j) * X(j, c);
+            test1 = test1 && porownajDouble(suma, B(i, c), 1e-9);
+        }
+    }
+    vector<double> b(k);
+    for (int i = 0; i < k; i++) b[i] = B(i, 2);
+    vector<double> x = blokowy.solve(b);
+    for (int i = 0; i < k; i++) {
+        test1 = test1 && porownajDouble(x[i], X(i, 2), 1e-12);
+    }
+    wypiszWynikTestu("RozkladCholeskyego - test 1 (macierz Grama)", test1);
+}
+
+void testRozkladCholeskyego2() {
+    // Test 2: macierz nieokreślona - Cholesky zgłasza status bez wyjątku, LDL^T ją rozkłada
+    Macierz A = {{0, 1, 2, 0},
+                 {1, 0, 0, 3},
+                 {2, 0, -1, 1},
+                 {0, 3, 1, 4}};
+    RozkladCholeskyego chol(A);
+    bool wyjatek = false;
+    try {
+        chol.solve({1, 1, 1, 1});
+    } catch (const runtime_error&) {
+        wyjatek = true;
+    }
+
+    RozkladLDLT ldlt(A);
+    vector<double> b = {1, 2, 3, 4};
+    vector<double> x = ldlt.solve(b);
+    vector<double> Ax = pomnoz(A, x);
+    RozkladLDLT::Bezwladnosc bw = ldlt.bezwladnosc();
+    RozkladLDLT spd(Macierz{{4, 1}, {1, 3}});
+
+    bool test2 = chol.status() == StatusRozkladu::NieDodatnioOkreslona && chol.kolumnaBledu() == 0 && wyjatek &&
+                 ldlt.poprawny() && !ldlt.dodatnioOkreslona() && bw.dodatnie + bw.ujemne == 4 && bw.ujemne > 0 &&
+                 spd.dodatnioOkreslona() &&
+                 RozkladLDLT(Macierz{{1, 1}, {1, 1}}).status() == StatusRozkladu::Osobliwa;
+    for (int i = 0; i < 4; i++) {
+        test2 = test2 && porownajDouble(Ax[i], b[i], 1e-12);
+    }
+    wypiszWynikTestu("RozkladCholeskyego - test 2 (LDL^T, brak dodatniej określoności)", test2);
+}
+
+void testMieszanaPrecyzja1() {
+    // Test 1: macierz dobrze uwarunkowana - wynik w dokładności double bez powrotu do rozkładu double
+    int n = 80;
+    Macierz A(n, n);
+    vector<double> x_dokladne(n);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            A(i, j) = sin(1.0 + 3.0 * i + 7.0 * j) + (i == j ? n : 0.0);
+        }
+        x_dokladne[i] = cos(0.3 * i) + 1.0 / 3.0;
+    }
+    vector<double> b = pomnoz(A, x_dokladne);
+
+    WynikMieszanejPrecyzji wynik = rozwiazUkladLU_mieszanaPrecyzja(A, b);
+    double maxBlad = 0.0;
+    for (int i = 0; i < n; i++) {
+        maxBlad = max(maxBlad, abs(wynik.x[i] - x_dokladne[i]));
+    }
+    bool test1 = !wynik.uzytoPodwojnejPrecyzji && wynik.krokiPoprawek >= 1 && wynik.krokiPoprawek <= 5 &&
+                 maxBlad < 1e-13 && wynik.residuumWzgledne < 1e-15;
+    wypiszWynikTestu("rozwiazUkladLU_mieszanaPrecyzja - test 1 (dobrze uwarunkowana)", test1);
+}
+
+void testMieszanaPrecyzja2() {
+    // Test 2: macierz bliska osobliwej (cond ~ 1e9 > 1 / eps float) - automatyczny powrót do double
+    int n = 10;
+    vector<vector<double>> H(n, vector<double>(n));
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            H[i][j] = 1.0 + (i == j ? 1e-8 * (i + 1) : 0.0) + (j == i + 1 ? 1e-9 : 0.0);
+        }
+    }
+    vector<double> b(n, 1.0);
+    WynikMieszanejPrecyzji wynik = rozwiazUkladLU_mieszanaPrecyzja(H, b);
+    vector<double> x_double = RozkladLU(H).solve(b);
+
+    bool test2 = wynik.uzytoPodwojnejPrecyzji && wynik.residuumWzgledne < 1e-12;
+    for (int i = 0; i < n; i++) {
+        test2 = test2 && wynik.x[i] == x_double[i];
+    }
+    wypiszWynikTestu("rozwiazUkladLU_mieszanaPrecyzja - test 2 (powrót do double)", test2);
+}
+
+void testWczytywanie1() {
+    // Test 1: format jak plikA.txt (linia "l.p.", N zapisane jako 3.0, tabulatory, \r\n, wielka litera A)
+    string sciezka = (filesystem::temp_directory_path() / "bibliotekaMN_wczytywanie1.txt").string();
+    {
+        ofstream plik(sciezka, ios::binary);
+        plik << "l.p.: 8\r\nN: 3.0\r\nb:\r\n  -99\t   57\t 1.5e2\t\r\n"
+             << "A:\r\n 4\t -1\t 0\t\r\n-1\t4\t-1\r\n\r\n 0\t -1\t +4 \r\n";
+    }
+    Macierz A;
+    vector<double> B;
+    int N = 0;
+    wczytajDaneMapowane(sciezka, A, B, N);
+    filesystem::remove(sciezka);
+
+    bool test1 = N == 3 && A.wiersze() == 3 && A.kolumny() == 3 && B.size() == 3 &&
+                 B[0] == -99 && B[1] == 57 && B[2] == 150 &&
+                 A(0, 0) == 4 && A(0, 1) == -1 && A(1, 2) == -1 && A(2, 2) == 4 && A(2, 0) == 0;
+    wypiszWynikTestu("wczytajDaneMapowane - test 1 (format pliku)", test1);
+}
+
+void testWczytywanie2() {
+    // Test 2: błędne dane - komunikat wskazuje plik i linię, wynik pozostaje nienaruszony
+    string sciezka = (filesystem::temp_directory_path() / "bibliotekaMN_wczytywanie2.txt").string();
+    auto komunikat = [&](const string& tresc) {
+        {
+            ofstream plik(sciezka, ios::binary);
+            plik << tresc;
+        }
+        Macierz A;
+        vector<double> B = {7};
+        int N = -1;
+        try {
+            wczytajDaneMapowane(sciezka, A, B, N);
+        } catch (const runtime_error& e) {
+            return (N == -1 && B.size() == 1) ? string(e.what()) : string();
+        }
+        return string();
+    };
+
+    string przecinek = komunikat("N: 2\nb:\n1 2\na:\n1 0\n0 1,5\n");
+    string krotkiWiersz = komunikat("N: 2\nb:\n1 2\na:\n1\n0 1\n");
+    string ulamkoweN = komunikat("N: 2.5\nb:\n1 2\n");
+    string brakPliku;
+    try {
+        Macierz A;
+        vector<double> B;
+        int N;
+        wczytajDaneMapowane(sciezka + ".brak", A, B, N);
+    } catch (const runtime_error& e) {
+        brakPliku = e.what();
+    }
+    filesystem::remove(sciezka);
+
+    bool test2 = przecinek.find(sciezka + ":6:") != string::npos &&
+                 przecinek.find("1,5") != string::npos &&
+                 krotkiWiersz.find(sciezka + ":5:") != string::npos &&
+                 ulamkoweN.find(":1:") != string::npos &&
+                 brakPliku.find("Nie można otworzyć pliku") != string::npos;
+    wypiszWynikTestu("wczytajDaneMapowane - test 2 (błędne dane)", test2);
+}
+
+void testFormatBinarny1() {
+    // Test 1: konwersja pliku tekstowego, widok na zmapowane dane i rozwiązanie bez kopii macierzy
+    string katalog = filesystem::temp_directory_path().string();
+    string tekstowy = katalog + "/bibliotekaMN_binarny1.txt";
+    string binarny = katalog + "/bibliotekaMN_binarny1.bmn";
+    {
+        ofstream plik(tekstowy);
+        plik << "N: 3\nb:\n1 2 3\nA:\n4 1 0\n1 4 1\n0 1 4\n";
+    }
+    konwertujNaBinarny(tekstowy, binarny);
+
+    bool test1;
+    {
+        PlikBinarny plik(binarny);
+        WidokMacierzy A = plik.macierzGesta();
+        vector<double> b = plik.wektor();
+        RaportZbieznosci wynik = metodaGradientowSprzezonych(operatorMacierzy(A), b, vector<double>(3, 0.0));
+        vector<double> x_lu = RozkladLU(A.doMacierzy()).solve(b);
+
+        test1 = plik.rodzaj() == RodzajMacierzy::Gesta && A.wiersze() == 3 && A.kolumny() == 3 &&
+                A(1, 0) == 1 && A(2, 2) == 4 && A(0, 2) == 0 && b.size() == 3 && b[2] == 3 &&
+                reinterpret_cast<uintptr_t>(A.wiersz(1)) % 64 == 0 && wynik.zbiezny;
+        for (int i = 0; i < 3; i++) {
+            test1 = test1 && porownajDouble(wynik.x[i], x_lu[i], 1e-8);
+        }
+    }
+    filesystem::remove(tekstowy);
+    filesystem::remove(binarny);
+    wypiszWynikTestu("PlikBinarny - test 1 (konwersja z tekstu)", test1);
+}
+
+void testFormatBinarny2() {
+    // Test 2: CSR i macierz pasmowa bez wektora b, odrzucanie uszkodzonych plików
+    string binarny = (filesystem::temp_directory_path() / "bibliotekaMN_binarny2.bmn").string();
+    MacierzRzadkaCSR A = macierzPoissona2D(6);
+    vector<double> x(A.kolumny());
+    for (size_t i = 0; i < x.size(); i++) x[i] = 1.0 + 0.1 * i;
+    vector<double> y_oczekiwane = pomnoz(A, x);
+
+    bool test2 = true;
+    vector<double> y;
+    zapiszBinarnie(binarny, A);
+    {
+        PlikBinarny plik(binarny);
+        operatorMacierzy(plik.macierzCSR())(x, y);
+        test2 = test2 && !plik.maWektor() && plik.macierzCSR().liczbaNiezerowych() == A.liczbaNiezerowych();
+        for (size_t i = 0; i < y.size(); i++) test2 = test2 && porownajDouble(y[i], y_oczekiwane[i], 1e-12);
+    }
+
+    MacierzPasmowa P = MacierzPasmowa::zGestej(A.doGestej());
+    zapiszBinarnie(binarny, P, y_oczekiwane);
+    {
+        PlikBinarny plik(binarny);
+        operatorMacierzy(plik.macierzPasmowa())(x, y);
+        test2 = test2 && plik.macierzPasmowa().dolna() == 6 && plik.wektor() == y_oczekiwane;
+        for (size_t i = 0; i < y.size(); i++) test2 = test2 && porownajDouble(y[i], y_oczekiwane[i], 1e-12);
+    }
+
+    // obcięty plik i zła sygnatura
+    auto odrzucony = [&](const string& zawartosc) {
+        {
+            ofstream plik(binarny, ios::binary | ios::trunc);
+            plik << zawartosc;
+        }
+        try {
+            PlikBinarny plik(binarny);
+        } catch (const runtime_error& e) {
+            return string(e.what()).find("Nieprawidłowy plik binarny") != string::npos;
+        }
+        return false;
+    };
+    zapiszBinarnie(binarny, A);
+    string pelny;
+    {
+        ifstream plik(binarny, ios::binary);
+        pelny.assign(istreambuf_iterator<char>(plik), istreambuf_iterator<char>());
+    }
+    string zlaSygnatura = pelny;
+    zlaSygnatura[0] = 'X';
+    test2 = test2 && odrzucony(pelny.substr(0, pelny.size() - 8)) && odrzucony(zlaSygnatura) &&
+            odrzucony(pelny.substr(0, 100));
+
+    // początek wiersza daleko poza liczbą elementów niezerowych - wyjątek zamiast czytania poza plikiem
+    NaglowekBinarny naglowek;
+    memcpy(&naglowek, pelny.data(), sizeof(naglowek));
+    string zlePoczatki = pelny;
+    int32_t pozaZakresem = 1000000;
+    memcpy(&zlePoczatki[naglowek.przesunieciePoczatkow + sizeof(int32_t)], &pozaZakresem, sizeof(pozaZakresem));
+    {
+        ofstream plik(binarny, ios::binary | ios::trunc);
+        plik << zlePoczatki;
+    }
+    try {
+        PlikBinarny plik(binarny);
+        test2 = false;
+    } catch (const runtime_error& e) {
+        test2 = test2 && string(e.what()).find("niespójne początki wierszy CSR") != string::npos;
+    }
+    filesystem::remove(binarny);
+    wypiszWynikTestu("PlikBinarny - test 2 (CSR, pasmowa, uszkodzone pliki)", test2);
+}
+
+void testMatrixMarket1() {
+    // Test 1: plik symmetric z komentarzami, pustą linią i powtórzoną pozycją; pattern general
+    string sciezka = (filesystem::temp_directory_path() / "bibliotekaMN_mm1.mtx").string();
+    {
+        ofstream plik(sciezka);
+        plik << "%%MatrixMarket matrix coordinate real symmetric\n"
+             << "% komentarz\n"
+             << "3 3 5\n"
+             << "1 1 4.0\n2 1 -1\n\n3 3 4e0\n2 2 4\n3 2 -0.5\n";
+    }
+    MacierzRzadkaCSR A = wczytajMatrixMarket(sciezka);
+    Macierz oczekiwana = {{4, -1, 0}, {-1, 4, -0.5}, {0, -0.5, 4}};
+    bool test1 = A.wiersze() == 3 && A.kolumny() == 3 && A.liczbaNiezerowych() == 7;
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            test1 = test1 && A.element(i, j) == oczekiwana(i, j);
+        }
+    }
+
+    {
+        ofstream plik(sciezka);
+        plik << "%%MatrixMarket matrix coordinate pattern general\r\n2 3 4\r\n1 3\r\n2 1\r\n1 1\r\n1 3\r\n";
+    }
+    MacierzRzadkaCSR B = wczytajMatrixMarket(sciezka);
+    test1 = test1 && B.wiersze() == 2 && B.kolumny() == 3 && B.liczbaNiezerowych() == 3 &&
+            B.element(0, 0) == 1 && B.element(0, 2) == 2 && B.element(1, 0) == 1 &&
+            B.indeksyKolumn()[0] == 0 && B.indeksyKolumn()[1] == 2;
+    filesystem::remove(sciezka);
+    wypiszWynikTestu("wczytajMatrixMarket - test 1 (symmetric, pattern, powtórzenia)", test1);
+}
+
+void testMatrixMarket2() {
+    // Test 2: zapis i ponowny odczyt bez utraty dokładności, błędy z numerem linii
+    string sciezka = (filesystem::temp_directory_path() / "bibliotekaMN_mm2.mtx").string();
+    MacierzRzadkaCSR A = macierzPoissona2D(5);
+    vector<double> w = A.wartosci();
+    w[3] = 1.0 / 3.0;
+    MacierzRzadkaCSR C(A.wiersze(), A.kolumny(), A.poczatkiWierszy(), A.indeksyKolumn(), w);
+
+    zapiszMatrixMarket(sciezka, C);
+    MacierzRzadkaCSR odczytana = wczytajMatrixMarket(sciezka);
+    zapiszMatrixMarket(sciezka, A, true);
+    MacierzRzadkaCSR symetryczna = wczytajMatrixMarket(sciezka);
+    bool test2 = odczytana.wartosci() == C.wartosci() && odczytana.indeksyKolumn() == C.indeksyKolumn() &&
+                 symetryczna.wartosci() == A.wartosci() && symetryczna.poczatkiWierszy() == A.poczatkiWierszy();
+
+    auto komunikat = [&](const string& tresc) {
+        {
+            ofstream plik(sciezka);
+            plik << tresc;
+        }
+        try {
+            wczytajMatrixMarket(sciezka);
+        } catch (const runtime_error& e) {
+            return string(e.what());
+        }
+        return string();
+    };
+    string pozaWymiarem = komunikat("%%MatrixMarket matrix coordinate real general\n2 2 2\n1 1 1\n3 1 1\n");
+    string zlaLiczba = komunikat("%%MatrixMarket matrix coordinate real general\n2 2 2\n1 1 1\n2 2 x\n");
+    string zaMalo = komunikat("%%MatrixMarket matrix coordinate real general\n2 2 3\n1 1 1\n2 2 1\n");
+    string gesta = komunikat("%%MatrixMarket matrix array real general\n2 2\n1\n2\n3\n4\n");
+    filesystem::remove(sciezka);
+
+    test2 = test2 && pozaWymiarem.find(sciezka + ":4:") != string::npos &&
+            zlaLiczba.find(sciezka + ":4:") != string::npos && zlaLiczba.find("\"x\"") != string::npos &&
+            zaMalo.find("znaleziono 2") != string::npos && gesta.find(sciezka + ":1:") != string::npos;
+    wypiszWynikTestu("zapiszMatrixMarket - test 2 (zapis, odczyt, błędy)", test2);
+}
+
+void testLUPozaPamiecia1() {
+    // Test 1: mały budżet wymusza wiele paneli (ostatni niepełny), wynik jak z RozkladLU
+    int n = 53;
+    Macierz A(n, n);
+    uint32_t ziarno = 12345;
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            ziarno = ziarno * 1664525u + 1013904223u;
+            A(i, j) = (ziarno >> 8) / double(1 << 24) - 0.5;
+        }
+    }
+    vector<double> b(n);
+    for (int i = 0; i < n; i++) b[i] = sin(i + 1.0);
+
+    UstawieniaPozaPamiecia ustawienia;
+    ustawienia.budzetPamieci = 3 * sizeof(double) * n * 6;   // panele po 6 kolumn
+    RozkladLUPozaPamiecia lu(A, ustawienia);
+    ustawienia.wczytywanieWyprzedzajace = false;
+    RozkladLUPozaPamiecia luBezWatku(A, ustawienia);
+
+    vector<double> x = lu.solve(b);
+    vector<double> x_bez = luBezWatku.solve(b);
+    vector<double> x_ref = RozkladLU(A).solve(b);
+    vector<double> Ax = pomnoz(A, x);
+
+    bool test1 = lu.szerokoscPanelu() == 6 && lu.liczbaPaneli() == 9 && x == x_bez;
+    for (int i = 0; i < n; i++) {
+        test1 = test1 && porownajDouble(x[i], x_ref[i], 1e-9) && porownajDouble(Ax[i], b[i], 1e-10);
+    }
+    wypiszWynikTestu("RozkladLUPozaPamiecia - test 1 (panele, zgodność z RozkladLU)", test1);
+}
+
+void testLUPozaPamiecia2() {
+    // Test 2: macierz z pliku binarnego, plik roboczy usuwany, błędy budżetu i osobliwości
+    string katalog = filesystem::temp_directory_path().string();
+    string binarny = katalog + "/bibliotekaMN_lu_zrodlo.bmn";
+    string roboczy = katalog + "/bibliotekaMN_lu_roboczy.tmp";
+    Macierz A = {{4, -2, 1, 0}, {3, 6, -4, 2}, {2, 1, 8, -1}, {1, 0, 2, 5}};
+    zapiszBinarnie(binarny, A, {3, 7, 10, 8});
+
+    bool test2;
+    {
+        PlikBinarny plik(binarny);
+        UstawieniaPozaPamiecia ustawienia;
+        ustawienia.budzetPamieci = 3 * sizeof(double) * 4 * 3;
+        ustawienia.plikRoboczy = roboczy;
+        RozkladLUPozaPamiecia lu(plik.macierzGesta(), ustawienia);
+        vector<double> x = lu.solve(plik.wektor());
+        vector<double> Ax = pomnoz(A, x);
+        test2 = filesystem::exists(roboczy) && lu.liczbaPaneli() == 2;
+        for (int i = 0; i < 4; i++) {
+            test2 = test2 && porownajDouble(Ax[i], plik.wektor()[i], 1e-12);
+        }
+    }
+    test2 = test2 && !filesystem::exists(roboczy);
+    filesystem::remove(binarny);
+
+    UstawieniaPozaPamiecia maly;
+    maly.budzetPamieci = 10;
+    bool budzet = false, osobliwa = false;
+    try {
+        RozkladLUPozaPamiecia lu(A, maly);
+    } catch (const invalid_argument&) {
+        budzet = true;
+    }
+    try {
+        RozkladLUPozaPamiecia lu(Macierz({{1, 2}, {2, 4}}));
+    } catch (const runtime_error&) {
+        osobliwa = true;
+    }
+    test2 = test2 && budzet && osobliwa;
+    wypiszWynikTestu("RozkladLUPozaPamiecia - test 2 (plik binarny, błędy)", test2);
+}
+
+void testRozkladLUWMiejscu1() {
+    // Test 1: spakowane czynniki zgadzają się z L i U z rozkladLU_blokowy, rozwiązanie układu
+    Macierz A = {{1, 2, 0}, {4, 1, 3}, {2, 5, 1}};
+    Macierz L, U;
+    vector<int> P;
+    rozkladLU_blokowy(A, L, U, P);
+
+    Macierz LU = A;
+    vector<int> zamiany;
+    rozkladLU_wMiejscu(LU, zamiany);
+
+    bool test1 = zamiany.size() == 3 && zamiany[0] == 1;
+    vector<int> permutacja = {0, 1, 2};
+    for (int k = 0; k < 3; k++) {
+        swap(permutacja[k], permutacja[zamiany[k]]);
+    }
+    test1 = test1 && permutacja == P;
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            test1 = test1 && LU(i, j) == (j < i ? L(i, j) : U(i, j));
+        }
+    }
+
+    vector<double> b = {5, 12, 14};     // x = {1, 2, 2}
+    rozwiazLU_wMiejscu(LU, zamiany, b);
+    test1 = test1 && porownajDouble(b[0], 1.0, 1e-12) && porownajDouble(b[1], 2.0, 1e-12) &&
+            porownajDouble(b[2], 2.0, 1e-12);
+    wypiszWynikTestu("rozkladLU_wMiejscu - test 1 (zgodność z rozkladLU_blokowy)", test1);
+}
+
+void testRozkladLUWMiejscu2() {
+    // Test 2: wiele prawych stron naraz, mały blok (wiele paneli), macierz osobliwa
+    int n = 20;
+    Macierz A(n, n);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            A(i, j) = 1.0 / (1 + abs(i - j)) + (i == j ? 0 : 0.3 * sin(i * n + j));
+        }
+    }
+    Macierz B(n, 3);
+    for (int i = 0; i < n; i++) {
+        B(i, 0) = 1;
+        B(i, 1) = i;
+        B(i, 2) = cos(i);
+    }
+
+    Macierz LU = A;
+    vector<int> zamiany;
+    rozkladLU_wMiejscu(LU, zamiany, 3);
+    Macierz X = B;
+    rozwiazLU_wMiejscu(LU, zamiany, X);
+
+    bool test2 = true;
+    for (int j = 0; j < 3; j++) {
+        vector<double> x(n);
+        for (int i = 0; i < n; i++) x[i] = X(i, j);
+        vector<double> Ax = pomnoz(A, x);
+        for (int i = 0; i < n; i++) test2 = test2 && porownajDouble(Ax[i], B(i, j), 1e-10);
+    }
+
+    Macierz osobliwa = {{1, 2}, {2, 4}};
+    bool wyjatek = false;
+    try {
+        rozkladLU_wMiejscu(osobliwa, zamiany);
+    } catch (const runtime_error&) {
+        wyjatek = true;
+    }
+    test2 = test2 && wyjatek;
+    wypiszWynikTestu("rozkladLU_wMiejscu - test 2 (wiele prawych stron, osobliwa)", test2);
+}
+
+void testUkladyMale1() {
+    // Test 1: rozmiar w czasie kompilacji - wymagany pivoting (zero na przekątnej), N = 3 i N = 16
+    array<array<double, 3>, 3> A3 = {{{0, 2, 1}, {1, 1, 1}, {2, 1, 0}}};
+    array<double, 3> x3 = rozwiazUkladStaly<3>(A3, {7, 6, 4});     // x = {1, 2, 3}
+    bool test1 = porownajDouble(x3[0], 1, 1e-12) && porownajDouble(x3[1], 2, 1e-12) &&
+                 porownajDouble(x3[2], 3, 1e-12);
+
+    array<array<double, 16>, 16> A16;
+    vector<vector<double>> A16w(16, vector<double>(16));
+    array<double, 16> b16;
+    vector<double> b16w(16);
+    for (int i = 0; i < 16; i++) {
+        for (int j = 0; j < 16; j++) {
+            A16[i][j] = A16w[i][j] = cos(i * 16 + j) + (i == j ? 2.0 : 0.0);
+        }
+        b16[i] = b16w[i] = i - 7.5;
+    }
+    array<double, 16> x16 = rozwiazUkladStaly<16>(A16, b16);
+    vector<double> x_ref = eliminacjaGaussa(A16w, b16w);
+    for (int i = 0; i < 16; i++) {
+        test1 = test1 && porownajDouble(x16[i], x_ref[i], 1e-10);
+    }
+
+    bool wyjatek = false;
+    try {
+        rozwiazUkladStaly<2>({{{1, 2}, {2, 4}}}, {1, 1});
+    } catch (const runtime_error&) {
+        wyjatek = true;
+    }
+    wypiszWynikTestu("rozwiazUkladStaly - test 1 (N = 3, N = 16, osobliwa)", test1 && wyjatek);
+}
+
+void testUkladyMale2() {
+    // Test 2: 1000 układów 4 x 4 w układzie struktury tablic, jeden osobliwy; wybór rozmiaru w czasie wykonania
+    const int N = 4, m = 1000;
+    vector<double> A(N * N * m), b(N * m);
+    uint32_t ziarno = 777;
+    for (double& a : A) {
+        ziarno = ziarno * 1664525u + 1013904223u;
+        a = (ziarno >> 8) / double(1 << 24) - 0.5;
+    }
+    for (int i = 0; i < N * m; i++) {
+        b[i] = 1.0 + (i % 7);
+    }
+    for (int i = 0; i < N; i++) {
+        for (int j = 0; j < N; j++) {
+            A[(i * N + j) * m + 500] = (j == 0 ? 1.0 : i + j);   // kolumny liniowo zależne
+        }
+    }
+    vector<double> A_kopia = A, b_kopia = b;
+    int osobliwe = rozwiazUkladyWsadowo<N>(m, A.data(), b.data());
+
+    bool test2 = osobliwe == 1 && isnan(b[500]);
+    for (int s = 0; s < m && test2; s++) {
+        if (s == 500) continue;
+        for (int i = 0; i < N; i++) {
+            double Ax = 0.0;
+            for (int j = 0; j < N; j++) {
+                Ax += A_kopia[(i * N + j) * m + s] * b[j * m + s];
+            }
+            test2 = test2 && porownajDouble(Ax, b_kopia[i * m + s], 1e-8);
+        }
+    }
+
+    vector<double> A_dyn = A_kopia, b_dyn = b_kopia;
+    test2 = test2 && rozwiazUkladyWsadowo(N, m, A_dyn.data(), b_dyn.data()) == 1;
+    for (int i = 0; i < N * m; i++) {
+        test2 = test2 && (b_dyn[i] == b[i] || (isnan(b_dyn[i]) && isnan(b[i])));
+    }
+    wypiszWynikTestu("rozwiazUkladyWsadowo - test 2 (struktura tablic, układ osobliwy)", test2);
+}
+
+void testPamiecRozkladow1() {
+    // Test 1: rozwiazUkladLU i eliminacjaGaussa korzystają z włączonej pamięci, liczniki trafień
+    PamiecRozkladow pamiec;
+    PamiecRozkladow* poprzednia = ustawPamiecRozkladow(&pamiec);
+
+    Macierz A = {{4, 1, 2}, {1, 5, 1}, {2, 1, 6}};
+    auto [y1, x1] = rozwiazUkladLU(A, {7, 7, 9});
+    auto [y2, x2] = rozwiazUkladLU(A, {4, 1, 2});
+    Macierz A_kopia = A;
+    vector<double> b = {14, 14, 18};
+    vector<double> x3 = eliminacjaGaussa(A_kopia, b);
+    ustawPamiecRozkladow(poprzednia);
+
+    bool test1 = pamiec.chybienia() == 1 && pamiec.trafienia() == 2 && pamiec.liczbaRozkladow() == 1 &&
+                 pamiec.zajetaPamiec() > 0 && b[0] == 14 && A_kopia(0, 0) == 4;
+    for (int i = 0; i < 3; i++) {
+        test1 = test1 && porownajDouble(x1[i], 1.0, 1e-12) && porownajDouble(x2[i], i == 0 ? 1.0 : 0.0, 1e-12) &&
+                porownajDouble(x3[i], 2.0, 1e-12);
+    }
+    vector<double> y_bez = rozwiazUkladLU(A, {7, 7, 9}).first;
+    for (int i = 0; i < 3; i++) {
+        test1 = test1 && porownajDouble(y1[i], y_bez[i], 1e-12);
+    }
+    test1 = test1 && pamiec.trafienia() == 2;      // po wyłączeniu pamięć nie jest używana
+    wypiszWynikTestu("PamiecRozkladow - test 1 (trafienia, zgodność wyników)", test1);
+}
+
+void testPamiecRozkladow2() {
+    // Test 2: limit pamięci usuwa najdawniej używany rozkład, unieważnienie, zmiana jednego elementu
+    Macierz A = {{2, 1}, {1, 3}};
+    Macierz B = {{5, 1}, {1, 4}};
+    Macierz C = {{7, 2}, {2, 6}};
+    PamiecRozkladow sonda;
+    sonda.rozklad(A);
+    size_t jeden = sonda.zajetaPamiec();
+
+    PamiecRozkladow pamiec(2 * jeden);
+    pamiec.rozklad(A);
+    pamiec.rozklad(B);
+    pamiec.rozklad(A);          // A staje się ostatnio używana
+    pamiec.rozklad(C);          // usuwa B
+    bool test2 = pamiec.liczbaRozkladow() == 2 && pamiec.usuniete() == 1 && pamiec.zajetaPamiec() <= 2 * jeden;
+    size_t chybienia = pamiec.chybienia();
+    pamiec.rozklad(A);
+    test2 = test2 && pamiec.chybienia() == chybienia;
+    pamiec.rozklad(B);
+    test2 = test2 && pamiec.chybienia() == chybienia + 1;
+
+    Macierz A2 = A;
+    A2(1, 1) = nextafter(3.0, 4.0);
+    test2 = test2 && !(SkrotMacierzy::oblicz(A) == SkrotMacierzy::oblicz(A2));
+    test2 = test2 && pamiec.uniewaznij(B) && !pamiec.uniewaznij(B);
+    pamiec.wyczysc();
+    test2 = test2 && pamiec.liczbaRozkladow() == 0 && pamiec.zajetaPamiec() == 0;
+    wypiszWynikTestu("PamiecRozkladow - test 2 (limit LRU, unieważnienie)", test2);
+}
+
+void testAktualizacjeLU1() {
+    // Test 1: wzór Shermana-Morrisona-Woodbury'ego - zmiana wiersza i poprawka rzędu 2
+    Macierz A = {{4, 1, 0, 1}, {1, 5, 2, 0}, {0, 2, 6, 1}, {1, 0, 1, 3}};
+    auto lu = make_shared<const RozkladLU>(A);
+    vector<double> b = {1, 2, 3, 4};
+
+    vector<double> roznica = {1, -1, 0.5, 2};
+    Macierz A1 = A;
+    for (int j = 0; j < 4; j++) A1(2, j) += roznica[j];
+    vector<double> x1 = RozkladLUZPoprawka::zmianaWiersza(lu, 2, roznica).solve(b);
+    vector<double> x1_wzor = RozkladLU(A1).solve(b);
+
+    Macierz U = {{1, 0}, {0, 1}, {2, 0}, {0, -1}};
+    Macierz V = {{0.5, 1}, {1, 0}, {0, 2}, {-1, 0.5}};
+    Macierz A2 = A;
+    for (int i = 0; i < 4; i++)
+        for (int j = 0; j < 4; j++)
+            A2(i, j) += U(i, 0) * V(j, 0) + U(i, 1) * V(j, 1);
+    RozkladLUZPoprawka poprawka(lu, U, V);
+    vector<double> x2 = poprawka.solve(b);
+    vector<double> x2_wzor = RozkladLU(A2).solve(b);
+
+    bool test1 = poprawka.rzadPoprawki() == 2;
+    for (int i = 0; i < 4; i++) {
+        test1 = test1 && porownajDouble(x1[i], x1_wzor[i], 1e-12) && porownajDouble(x2[i], x2_wzor[i], 1e-12);
+    }
+    // poprawka dająca macierz osobliwą: kolumna 0 zerowana
+    bool wyjatek = false;
+    try {
+        RozkladLUZPoprawka::zmianaKolumny(lu, 0, {-4, -1, 0, -1});
+    } catch (const runtime_error&) {
+        wyjatek = true;
+    }
+    wypiszWynikTestu("AktualizacjeLU - test 1 (Sherman-Morrison-Woodbury)", test1 && wyjatek);
+}
+
+void testAktualizacjeLU2() {
+    // Test 2: Forrest-Tomlin - kolejne zamiany kolumn zgodne z nowym rozkładem, ponowny rozkład, osobliwość
+    int n = 6;
+    Macierz A(n, n);
+    for (int i = 0; i < n; i++)
+        for (int j = 0; j < n; j++)
+            A(i, j) = (i == j) ? 10.0 + i : 1.0 / (1 + i + 2 * j);
+    vector<double> b = {1, -2, 3, 0.5, 2, -1};
+
+    RozkladLUAktualizowany rozklad(A);
+    bool test2 = true;
+    int kolumny[] = {2, 0, 5, 2, 3};
+    for (int t = 0; t < 5; t++) {
+        vector<double> kolumna(n);
+        for (int i = 0; i < n; i++) kolumna[i] = sin(1.0 + t + 3 * i) + (i == kolumny[t] ? 5.0 : 0.0);
+        rozklad.zamienKolumne(kolumny[t], kolumna);
+        for (int i = 0; i < n; i++) A(i, kolumny[t]) = kolumna[i];
+        vector<double> x = rozklad.solve(b);
+        vector<double> x_wzor = RozkladLU(A).solve(b);
+        for (int i = 0; i < n; i++) test2 = test2 && porownajDouble(x[i], x_wzor[i], 1e-10);
+    }
+    test2 = test2 && rozklad.liczbaRozkladow() == 1 && rozklad.liczbaAktualizacji() == 5;
+
+    // po przekroczeniu limitu aktualizacji rozkład jest liczony od nowa z pivotingiem
+    Macierz B = {{2, 1, 0}, {1, 3, 1}, {0, 1, 4}};
+    RozkladLUAktualizowany rozkladB(B, 1);
+    rozkladB.zamienKolumne(0, {0, 1, 1});
+    rozkladB.zamienKolumne(1, {1, 3, 1});
+    vector<double> xB = rozkladB.solve({1, 4, 5});      // A = {{0,1,0},{1,3,1},{1,1,4}}
+    test2 = test2 && rozkladB.liczbaRozkladow() == 2 && rozkladB.liczbaAktualizacji() == 0 &&
+            porownajDouble(xB[1], 1.0, 1e-12) && porownajDouble(xB[0] + 3 * xB[1] + xB[2], 4.0, 1e-12) &&
+            porownajDouble(xB[0] + xB[1] + 4 * xB[2], 5.0, 1e-12);
+
+    bool wyjatek = false;
+    try {
+        rozkladB.zamienKolumne(2, {0, 1, 1});
+    } catch (const runtime_error&) {
+        wyjatek = true;
+    }
+    test2 = test2 && wyjatek && rozkladB.macierz()(2, 2) == 4.0 && porownajDouble(rozkladB.solve({1, 4, 5})[1], 1.0, 1e-12);
+    wypiszWynikTestu("AktualizacjeLU - test 2 (Forrest-Tomlin, zamiana kolumn)", test2);
+}
+
+void testUwarunkowanie1() {
+    // Test 1: oszacowanie kappa_1 - macierz diagonalna (dokładnie) i macierz Hilberta 4x4 (kappa_1 = 28375)
+    Macierz D = {{1, 0, 0}, {0, 10, 0}, {0, 0, 100}};
+    RozkladLU luD(D);
+    bool test1 = porownajDouble(oszacujUwarunkowanie(D, luD), 100.0, 1e-9);
+
+    Macierz H(4, 4);
+    for (int i = 0; i < 4; i++)
+        for (int j = 0; j < 4; j++)
+            H(i, j) = 1.0 / (i + j + 1);
+    RozkladLU luH(H);
+    double kappa = oszacujUwarunkowanie(H, luH);
+    test1 = test1 && kappa <= 28375.0 * (1 + 1e-8) && kappa >= 28375.0 / 3;
+
+    // rozwiązanie transponowane: A^T x = b
+    Macierz A = {{2, 1, 0}, {4, 1, 3}, {1, 5, 1}};
+    RozkladLU lu(A);
+    vector<double> x = lu.solve_transposed({7, 9, 8});
+    for (int j = 0; j < 3; j++) {
+        double suma = 0.0;
+        for (int i = 0; i < 3; i++) suma += A(i, j) * x[i];
+        test1 = test1 && porownajDouble(suma, vector<double>{7, 9, 8}[j], 1e-12);
+    }
+    wypiszWynikTestu("Uwarunkowanie - test 1 (Hager-Higham, solve_transposed)", test1);
+}
+
+void testUwarunkowanie2() {
+    // Test 2: raport z rozwiązaniem - zgodność z rozwiazUkladLU i współczynnik wzrostu
+    Macierz A = {{1, 0, 1}, {-1, 1, 1}, {-1, -1, 1}};      // macierz Wilkinsona: u_33 = 4, wzrost 4
+    vector<double> b = {2, 1, -1};
+    RaportRozwiazaniaLU raport = rozwiazUkladLU_zRaportem(A, b);
+    auto [y, x] = rozwiazUkladLU(A, b);
+    bool test2 = porownajDouble(raport.wspolczynnikWzrostu, 4.0, 1e-12) && raport.uwarunkowanie >= 1.0;
+    for (int i = 0; i < 3; i++) {
+        test2 = test2 && porownajDouble(raport.x[i], x[i], 1e-12) && porownajDouble(raport.y[i], y[i], 1e-12) &&
+                porownajDouble(raport.x[i], 1.0, 1e-12);
+    }
+
+    Macierz Z = {{1, 1}, {1, 1 + 1e-8}};
+    test2 = test2 && rozwiazUkladLU_zRaportem(Z, {2, 2}).uwarunkowanie > 1e8;
+    wypiszWynikTestu("Uwarunkowanie - test 2 (raport z rozwiązaniem)", test2);
+}
+
+void testRozkladyRzadkie1() {
+    // Test 1: uporządkowania - siatka 15x15 (mniejsze wypełnienie niż naturalne), pomieszana macierz trójdiagonalna (RCM)
+    MacierzRzadkaCSR A = macierzPoissona2D(15);
+    int n = A.wiersze();
+    int naturalne = AnalizaSymboliczna(A, Uporzadkowanie::Naturalne).liczbaNiezerowychL();
+    int minimalnyStopien = AnalizaSymboliczna(A, Uporzadkowanie::MinimalnyStopien).liczbaNiezerowychL();
+    int podzial = AnalizaSymboliczna(A, Uporzadkowanie::PodzialZagniezdzony).liczbaNiezerowychL();
+    bool test1 = minimalnyStopien < naturalne && podzial < naturalne;
+    for (Uporzadkowanie u : {Uporzadkowanie::MinimalnyStopien, Uporzadkowanie::OdwrotneCuthillaMcKee,
+                             Uporzadkowanie::PodzialZagniezdzony}) {
+        vector<int> p = wyznaczUporzadkowanie(A, u);
+        vector<int> posortowana = p;
+        sort(posortowana.begin(), posortowana.end());
+        for (int i = 0; i < n; i++) test1 = test1 && posortowana[i] == i;
+    }
+
+    // Cholesky z podziałem zagnieżdżonym zgodny z rozwiązaniem gęstym
+    vector<double> b(n);
+    for (int i = 0; i < n; i++) b[i] = sin(0.3 * i) + 1.0;
+    RozkladRzadkiCholeskyego chol(A, Uporzadkowanie::PodzialZagniezdzony);
+    vector<double> x = chol.solve(b);
+    vector<double> x_gesty = RozkladLU(A.doGestej()).solve(b);
+    test1 = test1 && chol.poprawny();
+    for (int i = 0; i < n; i++) test1 = test1 && porownajDouble(x[i], x_gesty[i], 1e-10);
+
+    // ścieżka 0-1-...-29 z pomieszaną numeracją: RCM przywraca pasmo, rozkład bez wypełnienia
+    int m = 30;
+    vector<int> numer(m);
+    for (int i = 0; i < m; i++) numer[i] = (7 * i) % m;
+    vector<Trojka> trojki;
+    for (int i = 0; i < m; i++) {
+        trojki.push_back({numer[i], numer[i], 2.0});
+        if (i > 0) {
+            trojki.push_back({numer[i], numer[i - 1], -1.0});
+            trojki.push_back({numer[i - 1], numer[i], -1.0});
+        }
+    }
+    MacierzRzadkaCSR T = MacierzRzadkaCSR::zTrojek(m, m, trojki);
+    test1 = test1 && AnalizaSymboliczna(T, Uporzadkowanie::OdwrotneCuthillaMcKee).liczbaNiezerowychL() == m - 1 &&
+            AnalizaSymboliczna(T, Uporzadkowanie::Naturalne).liczbaNiezerowychL() > m - 1;
+    wypiszWynikTestu("RozkladyRzadkie - test 1 (uporządkowania, Cholesky)", test1);
+}
+
+void testRozkladyRzadkie2() {
+    // Test 2: LU niesymetrycznej macierzy, ponowne użycie analizy, zaburzony element główny, błędy
+    int n = 40;
+    vector<Trojka> trojki;
+    for (int i = 0; i < n; i++) {
+        trojki.push_back({i, i, 5.0 + i % 3});
+        trojki.push_back({i, (i + 1) % n, -1.0});
+        trojki.push_back({i, (i * 7 + 3) % n, 0.5});
+        trojki.push_back({(i * 11 + 5) % n, i, -0.75});
+    }
+    MacierzRzadkaCSR A = MacierzRzadkaCSR::zTrojek(n, n, trojki);
+    vector<double> b(n);
+    for (int i = 0; i < n; i++) b[i] = cos(0.7 * i);
+
+    auto analiza = make_shared<const AnalizaSymboliczna>(A, Uporzadkowanie::MinimalnyStopien);
+    RozkladRzadkiLU lu(A, analiza);
+    vector<double> x = lu.solve(b);
+    vector<double> x_gesty = RozkladLU(A.doGestej()).solve(b);
+    bool test2 = lu.liczbaZaburzonych() == 0 && lu.liczbaNiezerowych() >= A.liczbaNiezerowych() - n;
+    for (int i = 0; i < n; i++) test2 = test2 && porownajDouble(x[i], x_gesty[i], 1e-12);
+
+    // nowe wartości, ten sam wzorzec - ta sama analiza
+    MacierzRzadkaCSR A2 = A;
+    for (double& w : A2.wartosci()) w *= 2.0;
+    RozkladRzadkiLU lu2(A2, analiza);
+    vector<double> x2 = lu2.solve(b);
+    for (int i = 0; i < n; i++) test2 = test2 && porownajDouble(x2[i], 0.5 * x[i], 1e-12);
+
+    // zerowa przekątna: element główny zaburzony, wynik poprawiony iteracyjnie
+    MacierzRzadkaCSR P = MacierzRzadkaCSR::zTrojek(2, 2, {{0, 1, 1.0}, {1, 0, 1.0}, {1, 1, 2.0}});
+    RozkladRzadkiLU luP(P, Uporzadkowanie::Naturalne);
+    vector<double> xP = luP.solve({3, 4});      // y = 3, x = 4 - 6 = -2
+    test2 = test2 && luP.liczbaZaburzonych() == 1 && porownajDouble(xP[0], -2.0, 1e-12) && porownajDouble(xP[1], 3.0, 1e-12);
+    test2 = test2 && luP.solve_zRaportem({3, 4}).zbiezny;
+
+    // zaburzenie rzędu samego elementu głównego: poprawianie iteracyjne nie zbiega
+    MacierzRzadkaCSR Z = MacierzRzadkaCSR::zTrojek(2, 2, {{0, 1, 1.0}, {1, 0, 1.0}, {1, 1, 1e5}});
+    RozkladRzadkiLU luZ(Z, Uporzadkowanie::Naturalne);
+    RaportZbieznosci raportZ = luZ.solve_zRaportem({1, 1});
+    SledzenieLiczace liczace;
+    {
+        ZakresSledzenia zakres(&liczace);
+        luZ.solve({1, 1});
+    }
+#ifdef BIBLIOTEKA_MN_BEZ_SLEDZENIA
+    bool ostrzezenieZ = liczace.liczba == 0;
+#else
+    bool ostrzezenieZ = liczace.liczba > 0;
+#endif
+    test2 = test2 && luZ.liczbaZaburzonych() == 1 && !raportZ.zbiezny && raportZ.residuum > 1e-6 && ostrzezenieZ;
+
+    bool wyjatekWzorca = false;
+    try {
+        RozkladRzadkiLU zly(P, analiza);
+    } catch (const invalid_argument&) {
+        wyjatekWzorca = true;
+    }
+    MacierzRzadkaCSR N = MacierzRzadkaCSR::zTrojek(2, 2, {{0, 0, 1.0}, {0, 1, 2.0}, {1, 0, 2.0}, {1, 1, 1.0}});
+    RozkladRzadkiCholeskyego cholN(N, Uporzadkowanie::Naturalne);
+    test2 = test2 && wyjatekWzorca && !cholN.poprawny() && cholN.kolumnaBledu() == 1;
+    wypiszWynikTestu("RozkladyRzadkie - test 2 (LU, ponowne użycie analizy)", test2);
+}
+
+void testMacierz1() {
+    // Test 1: wiersze w ciągłym buforze wyrównane do 64 B, widok kolumny z krokiem
+    Macierz A = {{1, 2, 3}, {4, 5, 6}};
+    StalyWidokWektora kolumna = A.kolumna(1);
+
+    bool test1 = A.wiersze() == 2 && A.kolumny() == 3 && A.krok() % 8 == 0 &&
+                 reinterpret_cast<uintptr_t>(A.wiersz(1)) % 64 == 0 &&
+                 kolumna[0] == 2 && kolumna[1] == 5 && A(1, 2) == 6;
+    wypiszWynikTestu("Macierz - test 1 (układ pamięci i widoki)", test1);
+}
+
+void testMacierz2() {
+    // Test 2: eliminacjaGaussa na Macierz daje to samo co na vector<vector<double>>
+    vector<vector<double>> A = {{1, 2, 3}, {2, -1, 1}, {3, 0, -1}};
+    vector<double> b = {9, 8, 3};
+    Macierz M(A);
+    vector<double> bM = b;
+
+    vector<double> x = eliminacjaGaussa(A, b);
+    vector<double> xM = eliminacjaGaussa(M, bM);
+
+    bool test2 = porownajDouble(x[0], xM[0]) && porownajDouble(x[1], xM[1]) &&
+                 porownajDouble(x[2], xM[2]);
+    wypiszWynikTestu("Macierz - test 2 (eliminacjaGaussa)", test2);
+}
+
 // =============================================================================
 // TESTY DLA MODUŁU INTERPOLACJA
 // =============================================================================